@@ -0,0 +1,124 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include <eds/edid.h>
+
+#include "benchmark.h"
+
+#define DESCRIPTORS                             (0x4000)
+#define ITERATIONS                              (0x80)
+#define ROUNDS                                  (0x08)
+
+/* the decoding of the packed bitfield structure prior to the accessors */
+static inline uint32_t
+_bitfields(const struct edid_detailed_timing_descriptor * const dtb)
+{
+    return dtb->pixel_clock +
+           ((dtb->horizontal_active_hi << 8) | dtb->horizontal_active_lo) +
+           ((dtb->horizontal_blanking_hi << 8) | dtb->horizontal_blanking_lo) +
+           ((dtb->vertical_active_hi << 8) | dtb->vertical_active_lo) +
+           ((dtb->vertical_blanking_hi << 8) | dtb->vertical_blanking_lo) +
+           ((dtb->horizontal_sync_offset_hi << 8) | dtb->horizontal_sync_offset_lo) +
+           ((dtb->horizontal_sync_pulse_width_hi << 8) | dtb->horizontal_sync_pulse_width_lo) +
+           ((dtb->vertical_sync_offset_hi << 4) | dtb->vertical_sync_offset_lo) +
+           ((dtb->vertical_sync_pulse_width_hi << 4) | dtb->vertical_sync_pulse_width_lo) +
+           ((dtb->horizontal_image_size_hi << 8) | dtb->horizontal_image_size_lo) +
+           ((dtb->vertical_image_size_hi << 8) | dtb->vertical_image_size_lo) +
+           dtb->interlaced;
+}
+
+static inline uint32_t
+_accessors(const uint8_t * const dtb)
+{
+    return edid_detailed_timing_get_pixel_clock(dtb) +
+           edid_detailed_timing_get_horizontal_active(dtb) +
+           edid_detailed_timing_get_horizontal_blanking(dtb) +
+           edid_detailed_timing_get_vertical_active(dtb) +
+           edid_detailed_timing_get_vertical_blanking(dtb) +
+           edid_detailed_timing_get_horizontal_sync_offset(dtb) +
+           edid_detailed_timing_get_horizontal_sync_pulse_width(dtb) +
+           edid_detailed_timing_get_vertical_sync_offset(dtb) +
+           edid_detailed_timing_get_vertical_sync_pulse_width(dtb) +
+           edid_detailed_timing_get_horizontal_image_size(dtb) +
+           edid_detailed_timing_get_vertical_image_size(dtb) +
+           edid_detailed_timing_get_interlaced(dtb);
+}
+
+int
+main(void)
+{
+    const size_t size = sizeof(struct edid_detailed_timing_descriptor);
+    uint32_t state = 0x45445300, bitfields = 0, accessors = 0;
+    double bitfields_best = 0.0, accessors_best = 0.0;
+    uint8_t *corpus;
+
+    /* offset by one so that the descriptors are unaligned, as in an EDID */
+    if (!(corpus = malloc(DESCRIPTORS * size + 1)))
+        return EXIT_FAILURE;
+    for (size_t i = 0; i < DESCRIPTORS * size; i++)
+        corpus[i + 1] = benchmark_random(&state);
+
+    /* alternate the two and keep the best round so neither pays for warm up */
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        double start, seconds;
+
+        start = benchmark_now();
+        for (unsigned n = 0; n < ITERATIONS; n++)
+            for (size_t i = 0; i < DESCRIPTORS; i++)
+                bitfields += _bitfields((const struct edid_detailed_timing_descriptor *) (corpus + 1 + i * size));
+        seconds = benchmark_now() - start;
+        if (!round || seconds < bitfields_best)
+            bitfields_best = seconds;
+
+        start = benchmark_now();
+        for (unsigned n = 0; n < ITERATIONS; n++)
+            for (size_t i = 0; i < DESCRIPTORS; i++)
+                accessors += _accessors(corpus + 1 + i * size);
+        seconds = benchmark_now() - start;
+        if (!round || seconds < accessors_best)
+            accessors_best = seconds;
+    }
+
+    benchmark_report("packed bitfields", bitfields_best,
+                     (double) ITERATIONS * DESCRIPTORS);
+    benchmark_report("byte-offset accessors", accessors_best,
+                     (double) ITERATIONS * DESCRIPTORS);
+
+    free(corpus);
+
+    if (bitfields != accessors) {
+        fprintf(stderr, "accessors disagree with the bitfields\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,274 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <ranges>
+#include <vector>
+
+#include <eds/ranges.hpp>
+
+#include "benchmark.h"
+
+namespace {
+
+constexpr std::size_t edids = 0x1000;
+constexpr unsigned iterations = 0x100;
+constexpr std::size_t edid_size = eds::block_size * 2;
+
+/*
+ * A base block with two DTDs (and two monitor descriptors) and a CEA-861
+ * extension with random video, audio and other data blocks followed by DTDs.
+ */
+void
+generate(std::uint8_t *edid, std::uint32_t &state)
+{
+    std::uint8_t * const ext = edid + eds::block_size;
+    std::size_t offset;
+
+    for (std::size_t i = 0; i < edid_size; i++)
+        edid[i] = static_cast<std::uint8_t>(benchmark_random(&state));
+
+    edid[0x7e] = 1;
+    for (std::size_t i = 2; i < 4; i++)
+        edid[0x36 + i * 18 + 0] = edid[0x36 + i * 18 + 1] = 0;
+
+    ext[0] = 0x02;
+    ext[1] = 0x03;
+    for (offset = 4; offset < 0x50; ) {
+        const std::uint8_t tag = 1 + benchmark_random(&state) % 4;
+        const std::uint8_t length = 1 + benchmark_random(&state) % 15;
+
+        ext[offset] = static_cast<std::uint8_t>(tag << 5 | length);
+        offset = offset + 1 + length;
+    }
+    ext[2] = static_cast<std::uint8_t>(offset);
+    for (; offset + 18 <= eds::block_size - 1; offset += 18)
+        if (!ext[offset] && !ext[offset + 1])
+            ext[offset] = 1;
+    ext[offset] = ext[offset + 1] = 0;
+}
+
+std::uint32_t
+ranges_svd(std::span<const std::uint8_t> edid)
+{
+    std::uint32_t sum = 0;
+
+    for (const std::span<const std::uint8_t> block : eds::blocks(edid) | std::views::drop(1))
+        for (const eds::short_video_descriptor svd : eds::data_blocks(block)
+                | std::views::transform(eds::short_video_descriptors)
+                | std::views::join)
+            sum += svd.vic();
+    return sum;
+}
+
+std::uint32_t
+nested_svd(std::span<const std::uint8_t> edid)
+{
+    std::uint32_t sum = 0;
+
+    for (const std::span<const std::uint8_t> block : eds::blocks(edid) | std::views::drop(1))
+        for (const eds::data_block db : eds::data_blocks(block))
+            for (const eds::short_video_descriptor svd : eds::short_video_descriptors(db))
+                sum += svd.vic();
+    return sum;
+}
+
+std::uint32_t
+nested_sad(std::span<const std::uint8_t> edid)
+{
+    std::uint32_t sum = 0;
+
+    for (const std::span<const std::uint8_t> block : eds::blocks(edid) | std::views::drop(1))
+        for (const eds::data_block db : eds::data_blocks(block))
+            for (const eds::short_audio_descriptor sad : eds::short_audio_descriptors(db))
+                sum += sad.format() + sad.channels() + sad.sample_rates();
+    return sum;
+}
+
+std::uint32_t
+ranges_sad(std::span<const std::uint8_t> edid)
+{
+    std::uint32_t sum = 0;
+
+    for (const std::span<const std::uint8_t> block : eds::blocks(edid) | std::views::drop(1))
+        for (const eds::short_audio_descriptor sad : eds::data_blocks(block)
+                | std::views::transform(eds::short_audio_descriptors)
+                | std::views::join)
+            sum += sad.format() + sad.channels() + sad.sample_rates();
+    return sum;
+}
+
+std::uint32_t
+ranges_dtd(std::span<const std::uint8_t> edid)
+{
+    std::uint32_t sum = 0;
+
+    for (const eds::detailed_timing dtd : eds::detailed_timings(edid))
+        sum += dtd.pixel_clock();
+    for (const std::span<const std::uint8_t> block : eds::blocks(edid) | std::views::drop(1))
+        for (const eds::detailed_timing dtd : eds::cea861_detailed_timings(block))
+            sum += dtd.pixel_clock();
+    return sum;
+}
+
+/* the hand-written equivalents, with the same bounds checks */
+
+template <std::uint8_t Tag, typename Visit>
+std::uint32_t
+loop_data_blocks(const std::uint8_t *edid, std::size_t length, Visit visit)
+{
+    const std::size_t count = std::min<std::size_t>(length / eds::block_size,
+                                                    edid[0x7e] + std::size_t{1});
+    std::uint32_t sum = 0;
+
+    for (std::size_t i = 1; i < count; i++) {
+        const std::uint8_t * const block = edid + i * eds::block_size;
+        const std::uint8_t dtd_offset = block[2];
+        const std::uint8_t *db, *end;
+
+        if (block[0] != 0x02 || block[1] < 3 || dtd_offset < 4 ||
+            dtd_offset >= eds::block_size - 1)
+            continue;
+
+        for (db = block + 4, end = block + dtd_offset;
+             db < end && 1 + (db[0] & 0x1f) <= end - db;
+             db = db + 1 + (db[0] & 0x1f))
+            if (db[0] >> 5 == Tag)
+                sum += visit(db + 1, db + 1 + (db[0] & 0x1f));
+    }
+
+    return sum;
+}
+
+std::uint32_t
+loop_svd(const std::uint8_t *edid, std::size_t length)
+{
+    return loop_data_blocks<2>(edid, length, [](const std::uint8_t *p, const std::uint8_t *end) {
+        std::uint32_t sum = 0;
+        for (; p < end; p++)
+            sum += eds::cea861_short_video_descriptor_get_video_identification_code(p);
+        return sum;
+    });
+}
+
+std::uint32_t
+loop_sad(const std::uint8_t *edid, std::size_t length)
+{
+    return loop_data_blocks<1>(edid, length, [](const std::uint8_t *p, const std::uint8_t *end) {
+        std::uint32_t sum = 0;
+        for (; end - p >= 3; p += 3)
+            sum += eds::cea861_short_audio_descriptor_get_audio_format(p) +
+                   eds::cea861_short_audio_descriptor_get_channels(p) + 1 +
+                   eds::cea861_short_audio_descriptor_get_sample_rates(p);
+        return sum;
+    });
+}
+
+std::uint32_t
+loop_dtd(const std::uint8_t *edid, std::size_t length)
+{
+    const std::size_t count = std::min<std::size_t>(length / eds::block_size,
+                                                    edid[0x7e] + std::size_t{1});
+    std::uint32_t sum = 0;
+
+    for (const std::uint8_t *dtd = edid + 0x36; dtd + 18 <= edid + 0x7e; dtd += 18)
+        if (eds::edid_detailed_timing_get_pixel_clock(dtd))
+            sum += eds::edid_detailed_timing_get_pixel_clock(dtd) * 10;
+
+    for (std::size_t i = 1; i < count; i++) {
+        const std::uint8_t * const block = edid + i * eds::block_size;
+        const std::uint8_t dtd_offset = block[2];
+
+        if (block[0] != 0x02 || dtd_offset < 4 || dtd_offset >= eds::block_size - 1)
+            continue;
+
+        for (const std::uint8_t *dtd = block + dtd_offset;
+             dtd + 18 <= block + eds::block_size - 1 &&
+             eds::edid_detailed_timing_get_pixel_clock(dtd);
+             dtd += 18)
+            sum += eds::edid_detailed_timing_get_pixel_clock(dtd) * 10;
+    }
+
+    return sum;
+}
+
+template <typename Function>
+std::uint32_t
+run(const char *name, const std::vector<std::uint8_t> &corpus, Function function)
+{
+    const double start = benchmark_now();
+    std::uint32_t sum = 0;
+
+    for (unsigned n = 0; n < iterations; n++)
+        for (std::size_t i = 0; i < edids; i++)
+            sum += function(std::span<const std::uint8_t>(corpus.data() + i * edid_size,
+                                                          edid_size));
+    benchmark_report(name, benchmark_now() - start, double{iterations} * edids);
+    return sum;
+}
+
+}
+
+int
+main()
+{
+    std::vector<std::uint8_t> corpus(edids * edid_size);
+    std::uint32_t state = 0x45445300;
+    bool agree = true;
+
+    for (std::size_t i = 0; i < edids; i++)
+        generate(corpus.data() + i * edid_size, state);
+
+    const auto loop = [](auto function) {
+        return [function](std::span<const std::uint8_t> edid) {
+            return function(edid.data(), edid.size());
+        };
+    };
+
+    /* views::join is measured separately from nesting the views by hand */
+    const std::uint32_t svd = run("svd loop", corpus, loop(loop_svd));
+    agree &= run("svd views", corpus, nested_svd) == svd;
+    agree &= run("svd views | join", corpus, ranges_svd) == svd;
+
+    const std::uint32_t sad = run("sad loop", corpus, loop(loop_sad));
+    agree &= run("sad views", corpus, nested_sad) == sad;
+    agree &= run("sad views | join", corpus, ranges_sad) == sad;
+
+    agree &= run("dtd loop", corpus, loop(loop_dtd)) ==
+             run("dtd views", corpus, ranges_dtd);
+
+    if (!agree) {
+        std::fprintf(stderr, "views disagree with the loops\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
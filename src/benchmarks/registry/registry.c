@@ -0,0 +1,238 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <eds/edid.h>
+#include <eds/registry.h>
+
+#include "benchmark.h"
+
+#define CONNECTORS                              (0x08)
+#define READS                                   (0x400000)
+#define MAX_READERS                             (0x10)
+
+struct reader {
+    pthread_t           thread;
+    struct eds_registry *registry;
+    double              seconds;
+    uint64_t            sum;
+};
+
+static bool started;
+static bool stopped;
+
+/*
+ * An EDID 1.4 with HDR static metadata and an HDMI forum VSDB which ends
+ * after the VRR range (48-144 Hz), without the DSC fields.
+ */
+static size_t
+_edid(uint8_t * const edid, const uint16_t product)
+{
+    static const uint8_t base[] = {
+        0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,     /* header */
+        0x14, 0x93, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,     /* EDS, serial 1 */
+        0x01, 0x1e, 0x01, 0x04,                             /* 2020, 1.4 */
+        0xa5, 0x3c, 0x22, 0x78, 0x0b,                       /* continuous */
+        0xee, 0x95, 0xa3, 0x54, 0x4c, 0x99, 0x26, 0x0f, 0x50, 0x54,
+        0x00, 0x00, 0x00,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        /* 1920x1080 at 60 Hz */
+        0x02, 0x3a, 0x80, 0x18, 0x71, 0x38, 0x2d, 0x40, 0x58, 0x2c,
+        0x45, 0x00, 0x58, 0x54, 0x21, 0x00, 0x00, 0x1e,
+        /* range limits: 48-75 Hz, 30-90 kHz, 170 MHz */
+        0x00, 0x00, 0x00, 0xfd, 0x00, 0x30, 0x4b, 0x1e, 0x5a, 0x11,
+        0x01, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    };
+    static const uint8_t cea861[] = {
+        0x02, 0x03, 0x16, 0x00,
+        0xe6, 0x06, 0x0d, 0x01, 0x78, 0x5a, 0x00,           /* SDR, PQ, HLG */
+        0x6a, 0xd8, 0x5d, 0xc4, 0x01, 0x78, 0x00, 0x00,     /* HDMI forum */
+        0x00, 0x30, 0x90,                                   /* VRR 48-144 Hz */
+    };
+    uint8_t sum;
+
+    memset(edid, 0, 2 * EDID_BLOCK_SIZE);
+    memcpy(edid, base, sizeof(base));
+    memcpy(edid + EDID_BLOCK_SIZE, cea861, sizeof(cea861));
+    edid[10] = product & 0xff;
+    edid[11] = product >> 8;
+    edid[126] = 1;
+
+    for (unsigned block = 0; block < 2; block++) {
+        sum = 0;
+        for (size_t i = 0; i < EDID_BLOCK_SIZE - 1; i++)
+            sum = sum + edid[block * EDID_BLOCK_SIZE + i];
+        edid[block * EDID_BLOCK_SIZE + EDID_BLOCK_SIZE - 1] = -sum;
+    }
+
+    return 2 * EDID_BLOCK_SIZE;
+}
+
+/* the time of the calling thread; readers beyond the cores are not charged */
+static double
+_thread_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *
+_read(void * const context)
+{
+    struct reader * const reader = context;
+    struct eds_registry_reader *handle;
+    double start;
+
+    if (!(handle = eds_registry_reader_new(reader->registry)))
+        return NULL;
+
+    while (!__atomic_load_n(&started, __ATOMIC_ACQUIRE))
+        ;
+
+    start = _thread_now();
+    for (uint32_t i = 0; i < READS; i++) {
+        const struct eds_snapshot *snapshot;
+
+        eds_registry_read_lock(handle);
+        if ((snapshot = eds_registry_get(handle, i % CONNECTORS)))
+            reader->sum += snapshot->info.product + snapshot->max_vfreq +
+                           snapshot->eotfs;
+        eds_registry_read_unlock(handle);
+    }
+    reader->seconds = _thread_now() - start;
+
+    eds_registry_reader_free(handle);
+    return NULL;
+}
+
+static void *
+_publish(void * const context)
+{
+    struct eds_registry * const registry = context;
+    uint8_t edid[2 * EDID_BLOCK_SIZE];
+    const struct timespec interval = { 0, 100000 };
+    uint16_t product = 0;
+
+    /* a hotplug storm: far more frequent than any real display */
+    while (!__atomic_load_n(&stopped, __ATOMIC_ACQUIRE)) {
+        const size_t length = _edid(edid, product);
+
+        eds_registry_publish(registry, product % CONNECTORS, edid, length);
+        product++;
+        nanosleep(&interval, NULL);
+    }
+
+    return NULL;
+}
+
+static bool
+_check(struct eds_registry * const registry)
+{
+    struct eds_registry_reader *handle;
+    const struct eds_snapshot *snapshot;
+    bool result;
+
+    if (!(handle = eds_registry_reader_new(registry)))
+        return false;
+
+    eds_registry_read_lock(handle);
+    snapshot = eds_registry_get(handle, 0);
+    result = snapshot && snapshot->valid && snapshot->vrr &&
+             snapshot->min_vfreq == 48000 && snapshot->max_vfreq == 144000 &&
+             (snapshot->eotfs & EDID_COLOR_EOTF_MASK(EDID_COLOR_EOTF_PQ)) &&
+             (snapshot->eotfs & EDID_COLOR_EOTF_MASK(EDID_COLOR_EOTF_HLG)) &&
+             snapshot->max_luminance > 0.0f;
+    eds_registry_read_unlock(handle);
+
+    eds_registry_reader_free(handle);
+    return result;
+}
+
+int
+main(void)
+{
+    struct reader readers[MAX_READERS];
+    uint8_t edid[2 * EDID_BLOCK_SIZE];
+    struct eds_registry *registry;
+    pthread_t publisher;
+    char name[32];
+
+    if (!(registry = eds_registry_new(CONNECTORS)))
+        return EXIT_FAILURE;
+
+    for (uint32_t connector = 0; connector < CONNECTORS; connector++)
+        eds_registry_publish(registry, connector, edid,
+                             _edid(edid, connector));
+
+    if (!_check(registry)) {
+        fprintf(stderr, "snapshot capabilities are not decoded\n");
+        eds_registry_free(registry);
+        return EXIT_FAILURE;
+    }
+
+    /* the cost of a read must not grow with the number of readers */
+    for (unsigned count = 1; count <= MAX_READERS; count <<= 1) {
+        double seconds = 0.0;
+
+        __atomic_store_n(&started, false, __ATOMIC_RELEASE);
+        __atomic_store_n(&stopped, false, __ATOMIC_RELEASE);
+
+        for (unsigned i = 0; i < count; i++) {
+            readers[i] = (struct reader){ .registry = registry };
+            pthread_create(&readers[i].thread, NULL, _read, &readers[i]);
+        }
+        pthread_create(&publisher, NULL, _publish, registry);
+
+        __atomic_store_n(&started, true, __ATOMIC_RELEASE);
+
+        for (unsigned i = 0; i < count; i++) {
+            pthread_join(readers[i].thread, NULL);
+            seconds += readers[i].seconds;
+        }
+
+        __atomic_store_n(&stopped, true, __ATOMIC_RELEASE);
+        pthread_join(publisher, NULL);
+        eds_registry_reclaim(registry);
+
+        snprintf(name, sizeof(name), "read, %u reader%s", count,
+                 count == 1 ? "" : "s");
+        benchmark_report(name, seconds, (double) READS * count);
+    }
+
+    eds_registry_free(registry);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_access_h
+#define eds_access_h
+
+#include <stdint.h>
+
+/*
+ * Portable accessors for the fields described in fields.def.  They operate on
+ * the raw bytes and therefore do not depend on the host byte order, the
+ * compiler's bitfield layout, or the alignment of the buffer.  With a constant
+ * width the loads fold into a single (unaligned) load on little endian hosts.
+ *
+ * For each field `<structure>_get_<field>(const uint8_t *)` is defined, where
+ * the argument points to the start of the structure.
+ */
+
+static inline uint32_t
+eds_load_le(const uint8_t * const data, const unsigned bytes)
+{
+    switch (bytes) {
+    case 1:
+        return data[0];
+    case 2:
+        return (uint32_t) data[0] | (uint32_t) data[1] << 8;
+    case 3:
+        return (uint32_t) data[0] | (uint32_t) data[1] << 8 |
+               (uint32_t) data[2] << 16;
+    default:
+        return (uint32_t) data[0] | (uint32_t) data[1] << 8 |
+               (uint32_t) data[2] << 16 | (uint32_t) data[3] << 24;
+    }
+}
+
+static inline uint32_t
+eds_load_be(const uint8_t * const data, const unsigned bytes)
+{
+    switch (bytes) {
+    case 1:
+        return data[0];
+    case 2:
+        return (uint32_t) data[0] << 8 | (uint32_t) data[1];
+    case 3:
+        return (uint32_t) data[0] << 16 | (uint32_t) data[1] << 8 |
+               (uint32_t) data[2];
+    default:
+        return (uint32_t) data[0] << 24 | (uint32_t) data[1] << 16 |
+               (uint32_t) data[2] << 8 | (uint32_t) data[3];
+    }
+}
+
+#define EDS_BITS(value, shift, width)                                           \
+    (((uint32_t) (value) >> (shift)) & ((UINT32_C(1) << (width)) - 1))
+
+#define EDS_FIELD(structure, field, type, offset, shift, width)                  \
+    static inline type                                                          \
+    structure##_get_##field(const uint8_t * const data)                         \
+    {                                                                           \
+        return EDS_BITS(data[offset], shift, width);                            \
+    }
+
+/*
+ * The range hint lets the compiler see that the narrowing to type is lossless;
+ * without it every split field is re-extended after it is assembled.
+ */
+#define EDS_FIELD_SPLIT(structure, field, type, lo_offset, lo_shift, lo_width,  \
+                        hi_offset, hi_shift, hi_width)                          \
+    static inline type                                                          \
+    structure##_get_##field(const uint8_t * const data)                         \
+    {                                                                           \
+        const uint32_t value =                                                  \
+            (EDS_BITS(data[hi_offset], hi_shift, hi_width) << (lo_width)) |     \
+            EDS_BITS(data[lo_offset], lo_shift, lo_width);                      \
+                                                                                \
+        if (value >> ((lo_width) + (hi_width)))                                 \
+            __builtin_unreachable();                                            \
+        return value;                                                           \
+    }
+
+#define EDS_FIELD_LE(structure, field, type, offset, bytes)                     \
+    static inline type                                                          \
+    structure##_get_##field(const uint8_t * const data)                         \
+    {                                                                           \
+        return eds_load_le(data + (offset), bytes);                             \
+    }
+
+#define EDS_FIELD_BE(structure, field, type, offset, bytes)                     \
+    static inline type                                                          \
+    structure##_get_##field(const uint8_t * const data)                         \
+    {                                                                           \
+        return eds_load_be(data + (offset), bytes);                             \
+    }
+
+#include "fields.def"
+
+#undef EDS_FIELD_BE
+#undef EDS_FIELD_LE
+#undef EDS_FIELD_SPLIT
+#undef EDS_FIELD
+
+#endif
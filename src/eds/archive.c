@@ -0,0 +1,811 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "archive.h"
+
+#define ARCHIVE_MAGIC                           "EDSARCH"
+#define ARCHIVE_ORDER                           (0x01020304)
+#define ARCHIVE_VERSION                         (1)
+#define ARCHIVE_ALIGNMENT                       (0x40)
+#define ARCHIVE_MAX_PATCHES                     (0x10)
+#define ARCHIVE_NO_DELTA                        (0xffffffff)
+
+/*
+ * On disk, in host byte order (order identifies it):
+ *
+ *   header
+ *   blocks              blocks x 128 bytes
+ *   records             records x struct record
+ *   refs                uint32_t block index per block of each record
+ *   deltas              (offset, value) byte pairs
+ *   fingerprints        uint64_t per record, sorted
+ *   fingerprint records uint32_t record index, parallel to fingerprints
+ *   products            uint32_t manufacturer << 16 | product, sorted
+ *   product records     uint32_t record index, parallel to products
+ *
+ * Every section starts on an ARCHIVE_ALIGNMENT boundary.
+ */
+struct header {
+    char     magic[8];
+    uint32_t order;
+    uint32_t version;
+
+    uint32_t blocks;
+    uint32_t records;
+    uint32_t refs;
+    uint32_t deltas;
+
+    uint64_t blocks_offset;
+    uint64_t records_offset;
+    uint64_t refs_offset;
+    uint64_t deltas_offset;
+    uint64_t fingerprints_offset;
+    uint64_t fingerprint_records_offset;
+    uint64_t products_offset;
+    uint64_t product_records_offset;
+};
+
+/* block 0 is patched by delta_length bytes of pairs at delta unless none */
+struct record {
+    uint32_t refs;
+    uint32_t delta;
+    uint16_t blocks;
+    uint16_t delta_length;
+    uint16_t manufacturer;
+    uint16_t product;
+    uint64_t fingerprint;
+};
+
+struct table {
+    uint64_t *keys;
+    uint32_t *values;                           /* index + 1, 0 if empty */
+    size_t   capacity;
+    size_t   count;
+};
+
+struct eds_archive_writer {
+    uint8_t       *blocks;
+    size_t        block_count;
+    size_t        block_capacity;
+
+    struct record *records;
+    size_t        record_count;
+    size_t        record_capacity;
+
+    uint32_t      *refs;
+    size_t        ref_count;
+    size_t        ref_capacity;
+
+    uint8_t       *deltas;
+    size_t        delta_length;
+    size_t        delta_capacity;
+
+    struct table  contents;                     /* block hash -> block */
+    struct table  templates;                    /* fingerprint -> block */
+};
+
+struct eds_archive {
+    void                *mapping;
+    size_t              size;
+
+    const struct header *header;
+    const uint8_t       *blocks;
+    const struct record *records;
+    const uint32_t      *refs;
+    const uint8_t       *deltas;
+    const uint64_t      *fingerprints;
+    const uint32_t      *fingerprint_records;
+    const uint32_t      *products;
+    const uint32_t      *product_records;
+};
+
+static inline uint64_t
+_mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= UINT64_C(0xff51afd7ed558ccd);
+    value ^= value >> 33;
+    value *= UINT64_C(0xc4ceb9fe1a85ec53);
+    value ^= value >> 33;
+    return value;
+}
+
+static inline uint64_t
+_hash(const uint8_t * const data, const size_t length)
+{
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ data[i]) * UINT64_C(0x100000001b3);
+
+    return _mix(hash);
+}
+
+static bool
+_reserve(void ** const array, size_t * const capacity, const size_t count,
+         const size_t size)
+{
+    size_t grown = *capacity ? *capacity : 64;
+    void *resized;
+
+    if (count <= *capacity)
+        return true;
+
+    while (grown < count)
+        grown <<= 1;
+
+    if (!(resized = realloc(*array, grown * size)))
+        return false;
+
+    *array = resized;
+    *capacity = grown;
+    return true;
+}
+
+static bool
+_table_grow(struct table * const table)
+{
+    const size_t capacity = table->capacity ? table->capacity << 1 : 1024;
+    uint64_t * const keys = calloc(capacity, sizeof(*keys));
+    uint32_t * const values = calloc(capacity, sizeof(*values));
+
+    if (!keys || !values) {
+        free(keys);
+        free(values);
+        return false;
+    }
+
+    for (size_t i = 0; i < table->capacity; i++) {
+        size_t slot;
+
+        if (!table->values[i])
+            continue;
+
+        slot = _mix(table->keys[i]) & (capacity - 1);
+        while (values[slot])
+            slot = (slot + 1) & (capacity - 1);
+        keys[slot] = table->keys[i];
+        values[slot] = table->values[i];
+    }
+
+    free(table->keys);
+    free(table->values);
+    table->keys = keys;
+    table->values = values;
+    table->capacity = capacity;
+    return true;
+}
+
+/* the first slot holding \p key at or after \p slot, or an empty one */
+static size_t
+_table_probe(const struct table * const table, const uint64_t key, size_t slot)
+{
+    while (table->values[slot] && table->keys[slot] != key)
+        slot = (slot + 1) & (table->capacity - 1);
+    return slot;
+}
+
+/* the value stored for \p key plus one, 0 if there is none */
+static uint32_t
+_table_lookup(const struct table * const table, const uint64_t key)
+{
+    if (!table->capacity)
+        return 0;
+    return table->values[_table_probe(table, key,
+                                      _mix(key) & (table->capacity - 1))];
+}
+
+/* grow \p table until it can hold \p count keys */
+static bool
+_table_reserve(struct table * const table, const size_t count)
+{
+    while (count * 2 > table->capacity)
+        if (!_table_grow(table))
+            return false;
+    return true;
+}
+
+static bool
+_table_insert(struct table * const table, const uint64_t key,
+              const uint32_t value)
+{
+    size_t slot;
+
+    if (!_table_reserve(table, table->count + 1))
+        return false;
+
+    slot = _mix(key) & (table->capacity - 1);
+    while (table->values[slot])
+        slot = (slot + 1) & (table->capacity - 1);
+
+    table->keys[slot] = key;
+    table->values[slot] = value + 1;
+    table->count++;
+    return true;
+}
+
+static void
+_table_free(struct table * const table)
+{
+    free(table->keys);
+    free(table->values);
+}
+
+/* the index of the pooled copy of \p block, -1 if there is none */
+static int64_t
+_find_block(const struct eds_archive_writer * const writer,
+            const uint8_t * const block, const uint64_t hash)
+{
+    const struct table * const table = &writer->contents;
+    size_t slot;
+
+    if (!table->capacity)
+        return -1;
+
+    /* distinct blocks may share a hash; keep probing past mismatches */
+    slot = _mix(hash) & (table->capacity - 1);
+    while (table->values[slot = _table_probe(table, hash, slot)]) {
+        const uint32_t index = table->values[slot] - 1;
+
+        if (!memcmp(writer->blocks + (size_t) index * EDID_BLOCK_SIZE, block,
+                    EDID_BLOCK_SIZE))
+            return index;
+
+        slot = (slot + 1) & (table->capacity - 1);
+    }
+
+    return -1;
+}
+
+static int64_t
+_intern(struct eds_archive_writer * const writer, const uint8_t * const block)
+{
+    const uint64_t hash = _hash(block, EDID_BLOCK_SIZE);
+    int64_t index;
+
+    if ((index = _find_block(writer, block, hash)) >= 0)
+        return index;
+
+    if (writer->block_count == UINT32_MAX - 1 ||
+        !_reserve((void **) &writer->blocks, &writer->block_capacity,
+                  (writer->block_count + 1) * EDID_BLOCK_SIZE, 1) ||
+        !_table_insert(&writer->contents, hash, writer->block_count))
+        return -1;
+
+    memcpy(writer->blocks + writer->block_count * EDID_BLOCK_SIZE, block,
+           EDID_BLOCK_SIZE);
+    return writer->block_count++;
+}
+
+struct eds_archive_writer *
+eds_archive_writer_new(void)
+{
+    return calloc(1, sizeof(struct eds_archive_writer));
+}
+
+void
+eds_archive_writer_free(struct eds_archive_writer * const writer)
+{
+    if (!writer)
+        return;
+
+    _table_free(&writer->templates);
+    _table_free(&writer->contents);
+    free(writer->deltas);
+    free(writer->refs);
+    free(writer->records);
+    free(writer->blocks);
+    free(writer);
+}
+
+/* store the base block, as a delta against its model's template if close */
+static int64_t
+_add_base(struct eds_archive_writer * const writer,
+          struct record * const record, const uint8_t * const base)
+{
+    const uint64_t hash = _hash(base, EDID_BLOCK_SIZE);
+    const uint8_t *template;
+    uint8_t patches = 0;
+    uint32_t found;
+    int64_t index;
+
+    record->delta = ARCHIVE_NO_DELTA;
+
+    if ((index = _find_block(writer, base, hash)) >= 0)
+        return index;
+
+    if (!(found = _table_lookup(&writer->templates, record->fingerprint))) {
+        if ((index = _intern(writer, base)) < 0 ||
+            !_table_insert(&writer->templates, record->fingerprint, index))
+            return -1;
+        return index;
+    }
+
+    index = found - 1;
+    template = writer->blocks + index * EDID_BLOCK_SIZE;
+
+    for (uint8_t i = 0; i < EDID_BLOCK_SIZE; i++)
+        patches += template[i] != base[i];
+
+    if (patches > ARCHIVE_MAX_PATCHES)
+        return _intern(writer, base);
+
+    if (!_reserve((void **) &writer->deltas, &writer->delta_capacity,
+                  writer->delta_length + patches * 2, 1))
+        return -1;
+
+    record->delta = writer->delta_length;
+    record->delta_length = patches * 2;
+
+    for (uint8_t i = 0; i < EDID_BLOCK_SIZE; i++) {
+        if (template[i] == base[i])
+            continue;
+        writer->deltas[writer->delta_length++] = i;
+        writer->deltas[writer->delta_length++] = base[i];
+    }
+
+    return index;
+}
+
+bool
+eds_archive_writer_add(struct eds_archive_writer * const writer,
+                       const uint8_t * const data, const size_t length)
+{
+    struct record record;
+    size_t blocks = length / EDID_BLOCK_SIZE;
+    int64_t index;
+
+    if (!blocks)
+        return false;
+
+    if (blocks > (size_t) edid_get_extensions(data) + 1)
+        blocks = edid_get_extensions(data) + 1;
+
+    /*
+     * Reserve for the worst case -- every block new, the base block a delta
+     * and a template -- before anything is stored, so that the writer is left
+     * untouched if an allocation fails.  Nothing below can fail.
+     */
+    if (writer->record_count == UINT32_MAX ||
+        writer->block_count > UINT32_MAX - 1 - blocks ||
+        !_reserve((void **) &writer->records, &writer->record_capacity,
+                  writer->record_count + 1, sizeof(*writer->records)) ||
+        !_reserve((void **) &writer->refs, &writer->ref_capacity,
+                  writer->ref_count + blocks, sizeof(*writer->refs)) ||
+        !_reserve((void **) &writer->blocks, &writer->block_capacity,
+                  (writer->block_count + blocks) * EDID_BLOCK_SIZE, 1) ||
+        !_reserve((void **) &writer->deltas, &writer->delta_capacity,
+                  writer->delta_length + ARCHIVE_MAX_PATCHES * 2, 1) ||
+        !_table_reserve(&writer->contents, writer->contents.count + blocks) ||
+        !_table_reserve(&writer->templates, writer->templates.count + 1))
+        return false;
+
+    memset(&record, 0, sizeof(record));
+    record.refs = writer->ref_count;
+    record.blocks = blocks;
+    record.manufacturer = edid_get_manufacturer(data);
+    record.product = edid_get_product(data);
+    record.fingerprint = edid_model_fingerprint(data);
+
+    if ((index = _add_base(writer, &record, data)) < 0)
+        return false;
+    writer->refs[writer->ref_count + 0] = index;
+
+    for (size_t i = 1; i < blocks; i++) {
+        if ((index = _intern(writer, data + i * EDID_BLOCK_SIZE)) < 0)
+            return false;
+        writer->refs[writer->ref_count + i] = index;
+    }
+
+    writer->ref_count += blocks;
+    writer->records[writer->record_count++] = record;
+    return true;
+}
+
+struct key {
+    uint64_t key;
+    uint32_t record;
+};
+
+static int
+_compare_keys(const void * const lhs, const void * const rhs)
+{
+    const struct key * const a = lhs, * const b = rhs;
+
+    if (a->key != b->key)
+        return a->key < b->key ? -1 : 1;
+    return a->record < b->record ? -1 : a->record > b->record;
+}
+
+static inline uint64_t
+_align(const uint64_t offset)
+{
+    return (offset + ARCHIVE_ALIGNMENT - 1) & ~(uint64_t) (ARCHIVE_ALIGNMENT - 1);
+}
+
+static bool
+_write_section(FILE * const stream, const uint64_t offset,
+               const void * const data, const size_t size)
+{
+    static const uint8_t padding[ARCHIVE_ALIGNMENT];
+    const long position = ftell(stream);
+
+    if (position < 0 || (uint64_t) position > offset ||
+        fwrite(padding, 1, offset - position, stream) != offset - position)
+        return false;
+
+    return fwrite(data, 1, size, stream) == size;
+}
+
+int
+eds_archive_writer_write(const struct eds_archive_writer * const writer,
+                         const char * const path)
+{
+    const size_t records = writer->record_count;
+    struct key *fingerprints = NULL, *products = NULL;
+    uint64_t *fingerprint_keys = NULL;
+    uint32_t *fingerprint_records = NULL, *product_keys = NULL,
+             *product_records = NULL;
+    struct header header;
+    FILE *stream = NULL;
+    int rv = -ENOMEM;
+
+    if (!(fingerprints = calloc(records + 1, sizeof(*fingerprints))) ||
+        !(products = calloc(records + 1, sizeof(*products))) ||
+        !(fingerprint_keys = calloc(records + 1, sizeof(*fingerprint_keys))) ||
+        !(fingerprint_records = calloc(records + 1, sizeof(*fingerprint_records))) ||
+        !(product_keys = calloc(records + 1, sizeof(*product_keys))) ||
+        !(product_records = calloc(records + 1, sizeof(*product_records))))
+        goto out;
+
+    for (size_t i = 0; i < records; i++) {
+        const struct record * const record = &writer->records[i];
+
+        fingerprints[i].key = record->fingerprint;
+        fingerprints[i].record = i;
+        products[i].key = (uint32_t) record->manufacturer << 16 | record->product;
+        products[i].record = i;
+    }
+
+    qsort(fingerprints, records, sizeof(*fingerprints), _compare_keys);
+    qsort(products, records, sizeof(*products), _compare_keys);
+
+    for (size_t i = 0; i < records; i++) {
+        fingerprint_keys[i] = fingerprints[i].key;
+        fingerprint_records[i] = fingerprints[i].record;
+        product_keys[i] = products[i].key;
+        product_records[i] = products[i].record;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+    header.order = ARCHIVE_ORDER;
+    header.version = ARCHIVE_VERSION;
+    header.blocks = writer->block_count;
+    header.records = records;
+    header.refs = writer->ref_count;
+    header.deltas = writer->delta_length;
+
+    header.blocks_offset = _align(sizeof(header));
+    header.records_offset =
+        _align(header.blocks_offset + (uint64_t) header.blocks * EDID_BLOCK_SIZE);
+    header.refs_offset =
+        _align(header.records_offset + (uint64_t) records * sizeof(struct record));
+    header.deltas_offset =
+        _align(header.refs_offset + (uint64_t) header.refs * sizeof(uint32_t));
+    header.fingerprints_offset =
+        _align(header.deltas_offset + header.deltas);
+    header.fingerprint_records_offset =
+        _align(header.fingerprints_offset + (uint64_t) records * sizeof(uint64_t));
+    header.products_offset =
+        _align(header.fingerprint_records_offset + (uint64_t) records * sizeof(uint32_t));
+    header.product_records_offset =
+        _align(header.products_offset + (uint64_t) records * sizeof(uint32_t));
+
+    if (!(stream = fopen(path, "wb"))) {
+        rv = -errno;
+        goto out;
+    }
+
+    if (!_write_section(stream, 0, &header, sizeof(header)) ||
+        !_write_section(stream, header.blocks_offset, writer->blocks,
+                        (size_t) header.blocks * EDID_BLOCK_SIZE) ||
+        !_write_section(stream, header.records_offset, writer->records,
+                        records * sizeof(struct record)) ||
+        !_write_section(stream, header.refs_offset, writer->refs,
+                        header.refs * sizeof(uint32_t)) ||
+        !_write_section(stream, header.deltas_offset, writer->deltas,
+                        header.deltas) ||
+        !_write_section(stream, header.fingerprints_offset, fingerprint_keys,
+                        records * sizeof(uint64_t)) ||
+        !_write_section(stream, header.fingerprint_records_offset,
+                        fingerprint_records, records * sizeof(uint32_t)) ||
+        !_write_section(stream, header.products_offset, product_keys,
+                        records * sizeof(uint32_t)) ||
+        !_write_section(stream, header.product_records_offset, product_records,
+                        records * sizeof(uint32_t))) {
+        rv = -EIO;
+        goto out;
+    }
+
+    rv = 0;
+
+out:
+    if (stream && fclose(stream) && !rv)
+        rv = -errno;
+
+    free(product_records);
+    free(product_keys);
+    free(fingerprint_records);
+    free(fingerprint_keys);
+    free(products);
+    free(fingerprints);
+
+    return rv;
+}
+
+bool
+eds_archive_detect(const uint8_t * const data, const size_t length)
+{
+    return length >= sizeof(struct header) &&
+           !memcmp(data, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+}
+
+static inline bool
+_section(const struct eds_archive * const archive, const uint64_t offset,
+         const uint64_t count, const uint64_t size)
+{
+    return offset % ARCHIVE_ALIGNMENT == 0 && offset <= archive->size &&
+           count <= (archive->size - offset) / size;
+}
+
+struct eds_archive *
+eds_archive_open(const char * const path)
+{
+    struct eds_archive *archive;
+    const struct header *header;
+    struct stat st;
+    int fd;
+
+    if (!(archive = calloc(1, sizeof(*archive))))
+        return NULL;
+
+    if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0)
+        goto error;
+
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(struct header)) {
+        close(fd);
+        goto error;
+    }
+
+    archive->size = st.st_size;
+    archive->mapping = mmap(NULL, archive->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (archive->mapping == MAP_FAILED) {
+        archive->mapping = NULL;
+        goto error;
+    }
+
+    header = archive->header = archive->mapping;
+    if (memcmp(header->magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) ||
+        header->order != ARCHIVE_ORDER || header->version != ARCHIVE_VERSION)
+        goto error;
+
+    if (!_section(archive, header->blocks_offset, header->blocks, EDID_BLOCK_SIZE) ||
+        !_section(archive, header->records_offset, header->records, sizeof(struct record)) ||
+        !_section(archive, header->refs_offset, header->refs, sizeof(uint32_t)) ||
+        !_section(archive, header->deltas_offset, header->deltas, 1) ||
+        !_section(archive, header->fingerprints_offset, header->records, sizeof(uint64_t)) ||
+        !_section(archive, header->fingerprint_records_offset, header->records, sizeof(uint32_t)) ||
+        !_section(archive, header->products_offset, header->records, sizeof(uint32_t)) ||
+        !_section(archive, header->product_records_offset, header->records, sizeof(uint32_t)))
+        goto error;
+
+    archive->blocks = (const uint8_t *) archive->mapping + header->blocks_offset;
+    archive->records = (const void *) ((const uint8_t *) archive->mapping + header->records_offset);
+    archive->refs = (const void *) ((const uint8_t *) archive->mapping + header->refs_offset);
+    archive->deltas = (const uint8_t *) archive->mapping + header->deltas_offset;
+    archive->fingerprints = (const void *) ((const uint8_t *) archive->mapping + header->fingerprints_offset);
+    archive->fingerprint_records = (const void *) ((const uint8_t *) archive->mapping + header->fingerprint_records_offset);
+    archive->products = (const void *) ((const uint8_t *) archive->mapping + header->products_offset);
+    archive->product_records = (const void *) ((const uint8_t *) archive->mapping + header->product_records_offset);
+
+    return archive;
+
+error:
+    eds_archive_close(archive);
+    return NULL;
+}
+
+void
+eds_archive_close(struct eds_archive * const archive)
+{
+    if (!archive)
+        return;
+
+    if (archive->mapping)
+        munmap(archive->mapping, archive->size);
+    free(archive);
+}
+
+size_t
+eds_archive_count(const struct eds_archive * const archive)
+{
+    return archive->header->records;
+}
+
+bool
+eds_archive_get(const struct eds_archive * const archive, const size_t index,
+                struct eds_archive_edid * const edid)
+{
+    const struct header * const header = archive->header;
+    const struct record *record;
+
+    if (index >= header->records)
+        return false;
+
+    record = &archive->records[index];
+    if (!record->blocks || record->blocks > EDID_MAX_EXTENSIONS + 1 ||
+        record->refs > header->refs || record->blocks > header->refs - record->refs)
+        return false;
+
+    for (uint16_t i = 0; i < record->blocks; i++) {
+        const uint32_t block = archive->refs[record->refs + i];
+
+        if (block >= header->blocks)
+            return false;
+        edid->block[i] = archive->blocks + (size_t) block * EDID_BLOCK_SIZE;
+    }
+    edid->blocks = record->blocks;
+
+    if (record->delta != ARCHIVE_NO_DELTA) {
+        if (record->delta > header->deltas ||
+            record->delta_length > header->deltas - record->delta)
+            return false;
+
+        memcpy(edid->base, edid->block[0], EDID_BLOCK_SIZE);
+        for (uint16_t i = 0; i + 1 < record->delta_length; i += 2) {
+            const uint8_t offset = archive->deltas[record->delta + i];
+
+            if (offset >= EDID_BLOCK_SIZE)
+                return false;
+            edid->base[offset] = archive->deltas[record->delta + i + 1];
+        }
+        edid->block[0] = edid->base;
+    }
+
+    return true;
+}
+
+size_t
+eds_archive_copy(const struct eds_archive * const archive, const size_t index,
+                 uint8_t * const buffer, const size_t size)
+{
+    struct eds_archive_edid edid;
+
+    if (!eds_archive_get(archive, index, &edid) ||
+        edid.blocks * EDID_BLOCK_SIZE > size)
+        return 0;
+
+    for (size_t i = 0; i < edid.blocks; i++)
+        memcpy(buffer + i * EDID_BLOCK_SIZE, edid.block[i], EDID_BLOCK_SIZE);
+
+    return edid.blocks * EDID_BLOCK_SIZE;
+}
+
+/* the first of the \p count sorted \p keys which is not below \p key */
+static size_t
+_lower_bound64(const uint64_t * const keys, const size_t count,
+               const uint64_t key)
+{
+    size_t lo = 0, hi = count;
+
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+
+        if (keys[mid] < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+static size_t
+_lower_bound32(const uint32_t * const keys, const size_t count,
+               const uint64_t key)
+{
+    size_t lo = 0, hi = count;
+
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+
+        if (keys[mid] < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+size_t
+eds_archive_by_fingerprint(const struct eds_archive * const archive,
+                           const uint64_t fingerprint,
+                           const uint32_t ** const records)
+{
+    const size_t count = archive->header->records;
+    const size_t first = _lower_bound64(archive->fingerprints, count, fingerprint);
+    const size_t last = fingerprint == UINT64_MAX ? count :
+        _lower_bound64(archive->fingerprints, count, fingerprint + 1);
+
+    *records = archive->fingerprint_records + first;
+    return last - first;
+}
+
+size_t
+eds_archive_by_manufacturer(const struct eds_archive * const archive,
+                            const uint16_t manufacturer,
+                            const uint32_t ** const records)
+{
+    const uint64_t key = (uint64_t) manufacturer << 16;
+    const size_t count = archive->header->records;
+    const size_t first = _lower_bound32(archive->products, count, key);
+    const size_t last = _lower_bound32(archive->products, count, key + 0x10000);
+
+    *records = archive->product_records + first;
+    return last - first;
+}
+
+size_t
+eds_archive_by_product(const struct eds_archive * const archive,
+                       const uint16_t manufacturer, const uint16_t product,
+                       const uint32_t ** const records)
+{
+    const uint64_t key = (uint64_t) manufacturer << 16 | product;
+    const size_t count = archive->header->records;
+    const size_t first = _lower_bound32(archive->products, count, key);
+    const size_t last = _lower_bound32(archive->products, count, key + 1);
+
+    *records = archive->product_records + first;
+    return last - first;
+}
+
@@ -0,0 +1,145 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_archive_h
+#define eds_archive_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "edid.h"
+
+/*!
+ * A single file archive of raw EDIDs.  Blocks are stored once per distinct
+ * content; a base block which only differs from the first one seen for the
+ * same model (see edid_model_fingerprint) in a few bytes -- typically the
+ * serial number and manufacture date -- is stored as a list of byte patches
+ * against that template.  EDIDs are indexed by model fingerprint and by
+ * manufacturer and product code.
+ *
+ * The archive is read through a read-only mapping: every block is handed out
+ * in place, only a patched base block is rebuilt.
+ */
+struct eds_archive;
+struct eds_archive_writer;
+
+struct eds_archive_edid {
+    size_t        blocks;
+    const uint8_t *block[EDID_MAX_EXTENSIONS + 1];
+    uint8_t       base[EDID_BLOCK_SIZE];        /* a patched base block */
+};
+
+struct eds_archive_writer *
+eds_archive_writer_new(void);
+
+void
+eds_archive_writer_free(struct eds_archive_writer *writer);
+
+/*!
+ * Append the EDID in \p data; trailing bytes beyond the last complete block,
+ * and blocks beyond the extension count, are dropped.  Returns false if
+ * \p data holds no base block or on allocation failure.
+ */
+bool
+eds_archive_writer_add(struct eds_archive_writer *writer, const uint8_t *data,
+                       size_t length);
+
+/*! write the archive to \p path; returns 0 or a negative errno */
+int
+eds_archive_writer_write(const struct eds_archive_writer *writer,
+                         const char *path);
+
+/*! true if \p data (of \p length bytes) starts with an archive header */
+bool
+eds_archive_detect(const uint8_t *data, size_t length);
+
+/*! map the archive at \p path; NULL if it is not a valid archive */
+struct eds_archive *
+eds_archive_open(const char *path);
+
+void
+eds_archive_close(struct eds_archive *archive);
+
+/*! number of EDIDs in the archive */
+size_t
+eds_archive_count(const struct eds_archive *archive);
+
+/*! locate the blocks of EDID \p index; returns false if out of range */
+bool
+eds_archive_get(const struct eds_archive *archive, size_t index,
+                struct eds_archive_edid *edid);
+
+/*!
+ * The blocks of \p edid as a single buffer, in place, or NULL if they are not
+ * adjacent in the archive.  A patched base block is adjacent to nothing.
+ */
+static inline const uint8_t *
+eds_archive_edid_data(const struct eds_archive_edid * const edid)
+{
+    if (edid->block[0] == edid->base)
+        return edid->blocks == 1 ? edid->base : NULL;
+
+    for (size_t i = 1; i < edid->blocks; i++)
+        if (edid->block[i] != edid->block[0] + i * EDID_BLOCK_SIZE)
+            return NULL;
+
+    return edid->block[0];
+}
+
+/*!
+ * Copy EDID \p index into \p buffer.  Returns its length, or 0 if out of
+ * range or larger than \p size.
+ */
+size_t
+eds_archive_copy(const struct eds_archive *archive, size_t index,
+                 uint8_t *buffer, size_t size);
+
+/*!
+ * The EDIDs of the model \p fingerprint.  \p records is pointed at their
+ * indices, in archive order; returns their number.
+ */
+size_t
+eds_archive_by_fingerprint(const struct eds_archive *archive,
+                           uint64_t fingerprint, const uint32_t **records);
+
+/*! as eds_archive_by_fingerprint, for a manufacturer (PNP ID) */
+size_t
+eds_archive_by_manufacturer(const struct eds_archive *archive,
+                            uint16_t manufacturer, const uint32_t **records);
+
+/*! as eds_archive_by_fingerprint, for a manufacturer and product code */
+size_t
+eds_archive_by_product(const struct eds_archive *archive,
+                       uint16_t manufacturer, uint16_t product,
+                       const uint32_t **records);
+
+#endif
+
@@ -0,0 +1,296 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "edid.h"
+#include "cea861.h"
+#include "audio.h"
+
+#define FL                                      EDID_SPEAKER_FL
+#define FR                                      EDID_SPEAKER_FR
+#define LFE                                     EDID_SPEAKER_LFE
+#define FC                                      EDID_SPEAKER_FC
+#define RL                                      EDID_SPEAKER_RL
+#define RR                                      EDID_SPEAKER_RR
+#define RC                                      EDID_SPEAKER_RC
+#define FLC                                     EDID_SPEAKER_FLC
+#define FRC                                     EDID_SPEAKER_FRC
+#define RLC                                     EDID_SPEAKER_RLC
+#define RRC                                     EDID_SPEAKER_RRC
+
+/* CEA-861-D Table 20 */
+static const struct edid_audio_channel_map edid_audio_channel_maps[] = {
+    { 0x00, 2, 0, { FL, FR,   0,  0,  0,  0,   0,   0 } },
+    { 0x01, 3, 1, { FL, FR, LFE,  0,  0,  0,   0,   0 } },
+    { 0x02, 3, 0, { FL, FR,   0, FC,  0,  0,   0,   0 } },
+    { 0x03, 4, 1, { FL, FR, LFE, FC,  0,  0,   0,   0 } },
+    { 0x04, 3, 0, { FL, FR,   0,  0, RC,  0,   0,   0 } },
+    { 0x05, 4, 1, { FL, FR, LFE,  0, RC,  0,   0,   0 } },
+    { 0x06, 4, 0, { FL, FR,   0, FC, RC,  0,   0,   0 } },
+    { 0x07, 5, 1, { FL, FR, LFE, FC, RC,  0,   0,   0 } },
+    { 0x08, 4, 0, { FL, FR,   0,  0, RL, RR,   0,   0 } },
+    { 0x09, 5, 1, { FL, FR, LFE,  0, RL, RR,   0,   0 } },
+    { 0x0a, 5, 0, { FL, FR,   0, FC, RL, RR,   0,   0 } },
+    { 0x0b, 6, 1, { FL, FR, LFE, FC, RL, RR,   0,   0 } },
+    { 0x0c, 5, 0, { FL, FR,   0,  0, RL, RR,  RC,   0 } },
+    { 0x0d, 6, 1, { FL, FR, LFE,  0, RL, RR,  RC,   0 } },
+    { 0x0e, 6, 0, { FL, FR,   0, FC, RL, RR,  RC,   0 } },
+    { 0x0f, 7, 1, { FL, FR, LFE, FC, RL, RR,  RC,   0 } },
+    { 0x10, 6, 0, { FL, FR,   0,  0, RL, RR, RLC, RRC } },
+    { 0x11, 7, 1, { FL, FR, LFE,  0, RL, RR, RLC, RRC } },
+    { 0x12, 7, 0, { FL, FR,   0, FC, RL, RR, RLC, RRC } },
+    { 0x13, 8, 1, { FL, FR, LFE, FC, RL, RR, RLC, RRC } },
+    { 0x14, 4, 0, { FL, FR,   0,  0,  0,  0, FLC, FRC } },
+    { 0x15, 5, 1, { FL, FR, LFE,  0,  0,  0, FLC, FRC } },
+    { 0x16, 5, 0, { FL, FR,   0, FC,  0,  0, FLC, FRC } },
+    { 0x17, 6, 1, { FL, FR, LFE, FC,  0,  0, FLC, FRC } },
+    { 0x18, 5, 0, { FL, FR,   0,  0, RC,  0, FLC, FRC } },
+    { 0x19, 6, 1, { FL, FR, LFE,  0, RC,  0, FLC, FRC } },
+    { 0x1a, 6, 0, { FL, FR,   0, FC, RC,  0, FLC, FRC } },
+    { 0x1b, 7, 1, { FL, FR, LFE, FC, RC,  0, FLC, FRC } },
+    { 0x1c, 6, 0, { FL, FR,   0,  0, RL, RR, FLC, FRC } },
+    { 0x1d, 7, 1, { FL, FR, LFE,  0, RL, RR, FLC, FRC } },
+    { 0x1e, 7, 0, { FL, FR,   0, FC, RL, RR, FLC, FRC } },
+    { 0x1f, 8, 1, { FL, FR, LFE, FC, RL, RR, FLC, FRC } },
+};
+
+/*
+ * The channel allocation for each speaker allocation.  Only the speakers of
+ * CEA-861-D (the low seven bits of the payload) take part in the choice.  The
+ * allocation with the most channels wins, the lowest on a tie.  Every channel
+ * allocation includes front left/right, so a payload without them has none
+ * but the plain stereo allocation.
+ */
+static const uint8_t edid_audio_speaker_allocations[0x80] = {
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b,
+    0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f,
+    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
+    0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
+    0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
+};
+
+#undef FL
+#undef FR
+#undef LFE
+#undef FC
+#undef RL
+#undef RR
+#undef RC
+#undef FLC
+#undef FRC
+#undef RLC
+#undef RRC
+
+/* the matrix for \p channels channels at each rate in \p rates */
+static inline uint64_t
+_matrix(const uint8_t rates, const uint8_t channels)
+{
+    const uint64_t counts = (1u << channels) - 1;
+    uint64_t matrix = 0;
+
+    for (uint8_t rate = 0; rate < EDID_AUDIO_SAMPLE_RATES; rate++)
+        if (rates & (1 << rate))
+            matrix |= counts << (rate << 3);
+
+    return matrix;
+}
+
+/*
+ * Record \p value for each cell of a descriptor, keeping the largest value
+ * (a maximum bit rate) or the union (a mask).
+ */
+static inline void
+_detail(uint8_t detail[EDID_AUDIO_CELLS], const uint8_t rates,
+        const uint8_t channels, const uint8_t value, const bool maximum)
+{
+    for (uint8_t rate = 0; rate < EDID_AUDIO_SAMPLE_RATES; rate++) {
+        if (!(rates & (1 << rate)))
+            continue;
+
+        for (uint8_t count = 1; count <= channels; count++) {
+            uint8_t * const cell = &detail[EDID_AUDIO_CELL(rate, count)];
+
+            if (maximum)
+                *cell = value > *cell ? value : *cell;
+            else
+                *cell = *cell | value;
+        }
+    }
+}
+
+static void
+_short_audio_descriptor(void * const context, const uint8_t block,
+                        const struct cea861_short_audio_descriptor * const sad)
+{
+    const uint8_t * const data = (const uint8_t *) sad;
+    struct edid_audio_caps * const caps = context;
+    const uint8_t format = cea861_short_audio_descriptor_get_audio_format(data);
+    const uint8_t rates = cea861_short_audio_descriptor_get_sample_rates(data);
+    const uint8_t channels = cea861_short_audio_descriptor_get_channels(data) + 1;
+    const uint8_t flags = cea861_short_audio_descriptor_get_flags(data);
+
+    (void) block;
+
+    switch (format) {
+    case CEA861_AUDIO_FORMAT_RESERVED:
+        break;
+    case CEA861_AUDIO_FORMAT_AC_3:
+    case CEA861_AUDIO_FORMAT_MPEG_1:
+    case CEA861_AUDIO_FORMAT_MP3:
+    case CEA861_AUDIO_FORMAT_MPEG2:
+    case CEA861_AUDIO_FORMAT_AAC_LC:
+    case CEA861_AUDIO_FORMAT_DTS:
+    case CEA861_AUDIO_FORMAT_ATRAC:
+        /* maximum bit rate */
+        caps->format[format] |= _matrix(rates, channels);
+        _detail(caps->detail[format], rates, channels, flags, true);
+        break;
+    case CEA861_AUDIO_FORMAT_EXTENDED: {
+        const uint8_t code =
+            cea861_short_audio_descriptor_get_extension_code(data);
+
+        caps->extended[code] |= _matrix(rates, channels);
+        _detail(caps->extended_detail[code], rates, channels, flags & 0x7,
+                false);
+        break;
+    }
+    default:
+        caps->format[format] |= _matrix(rates, channels);
+        _detail(caps->detail[format], rates, channels, flags, false);
+        break;
+    }
+}
+
+static void
+_speaker_allocation(void * const context, const uint8_t block,
+                    const struct cea861_speaker_allocation_data_block * const sadb)
+{
+    struct edid_audio_caps * const caps = context;
+
+    (void) block;
+
+    caps->speakers |=
+        cea861_speaker_allocation_data_block_get_payload((const uint8_t *) sadb) & 0x7ff;
+}
+
+static const struct edid_visitor _audio_visitor = {
+    .short_audio_descriptor = _short_audio_descriptor,
+    .speaker_allocation     = _speaker_allocation,
+};
+
+bool
+edid_audio_caps_decode(struct edid_audio_caps * const caps,
+                       const uint8_t * const data, const size_t length)
+{
+    size_t count;
+
+    memset(caps, 0, sizeof(*caps));
+
+    if (!edid_visit(data, length, &_audio_visitor, caps, NULL))
+        return false;
+
+    count = length / EDID_BLOCK_SIZE;
+    if (count > (size_t) edid_get_extensions(data) + 1)
+        count = edid_get_extensions(data) + 1;
+
+    for (size_t i = 1; i < count; i++) {
+        const uint8_t * const block = data + i * EDID_BLOCK_SIZE;
+
+        if (block[0] != EDID_EXTENSION_CEA ||
+            cea861_timing_block_get_revision(block) < 2 ||
+            !cea861_timing_block_get_basic_audio_supported(block))
+            continue;
+
+        caps->format[CEA861_AUDIO_FORMAT_LPCM] |= _matrix(0x07, 2);
+        _detail(caps->detail[CEA861_AUDIO_FORMAT_LPCM], 0x07, 2, 0x01, false);
+        break;
+    }
+
+    /* a sink without a speaker allocation has front left/right */
+    if (!caps->speakers && caps->format[CEA861_AUDIO_FORMAT_LPCM])
+        caps->speakers = 0x0001;
+
+    return true;
+}
+
+void
+edid_audio_caps_intersect(struct edid_audio_caps * const caps,
+                          const struct edid_audio_caps * const sinks,
+                          const size_t count)
+{
+    if (!count) {
+        memset(caps, 0, sizeof(*caps));
+        return;
+    }
+
+    *caps = sinks[0];
+
+    for (size_t i = 1; i < count; i++) {
+        const struct edid_audio_caps * const sink = &sinks[i];
+
+        for (uint8_t format = 0; format < EDID_AUDIO_FORMATS; format++)
+            caps->format[format] &= sink->format[format];
+        for (uint8_t code = 0; code < EDID_AUDIO_EXTENDED_FORMATS; code++)
+            caps->extended[code] &= sink->extended[code];
+
+        /* a cell which a sink lacks has a detail of 0 and so drops out */
+        for (uint8_t format = 0; format < EDID_AUDIO_FORMATS; format++) {
+            const bool bitrate = format >= CEA861_AUDIO_FORMAT_AC_3 &&
+                                 format <= CEA861_AUDIO_FORMAT_ATRAC;
+
+            for (uint8_t cell = 0; cell < EDID_AUDIO_CELLS; cell++) {
+                uint8_t * const detail = &caps->detail[format][cell];
+
+                if (bitrate)
+                    *detail = sink->detail[format][cell] < *detail
+                            ? sink->detail[format][cell] : *detail;
+                else
+                    *detail = *detail & sink->detail[format][cell];
+            }
+        }
+        for (uint8_t code = 0; code < EDID_AUDIO_EXTENDED_FORMATS; code++)
+            for (uint8_t cell = 0; cell < EDID_AUDIO_CELLS; cell++)
+                caps->extended_detail[code][cell] &= sink->extended_detail[code][cell];
+
+        caps->speakers &= sink->speakers;
+    }
+}
+
+const struct edid_audio_channel_map *
+edid_audio_channel_map(const uint16_t speakers)
+{
+    return &edid_audio_channel_maps[edid_audio_speaker_allocations[speakers & 0x7f]];
+}
+
@@ -0,0 +1,172 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_audio_h
+#define eds_audio_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define EDID_AUDIO_FORMATS                      (0x10)
+#define EDID_AUDIO_EXTENDED_FORMATS             (0x20)
+#define EDID_AUDIO_SAMPLE_RATES                 (0x07)
+#define EDID_AUDIO_CHANNEL_MAPS                 (0x20)
+#define EDID_AUDIO_CELLS                        (0x40)
+
+/* the matrix bit (and detail index) for \p channels channels at \p rate */
+#define EDID_AUDIO_CELL(rate, channels)         (((rate) << 3) + (channels) - 1)
+
+enum edid_audio_sample_rate {
+    EDID_AUDIO_SAMPLE_RATE_32_kHz,
+    EDID_AUDIO_SAMPLE_RATE_44_1_kHz,
+    EDID_AUDIO_SAMPLE_RATE_48_kHz,
+    EDID_AUDIO_SAMPLE_RATE_88_2_kHz,
+    EDID_AUDIO_SAMPLE_RATE_96_kHz,
+    EDID_AUDIO_SAMPLE_RATE_176_4_kHz,
+    EDID_AUDIO_SAMPLE_RATE_192_kHz,
+};
+
+/*!
+ * Audio capabilities of a sink.  Each format (indexed by cea861_audio_format,
+ * or by extension code for the extended formats) is a 64-bit matrix with one
+ * byte per sample rate; bit n of a rate's byte is set if n + 1 channels can be
+ * carried at that rate.  A descriptor for n channels sets every count up to n,
+ * so that the capabilities common to several sinks are the bitwise AND of
+ * their matrices.
+ *
+ * detail holds the third byte of the descriptors for each cell of the matrix
+ * (see EDID_AUDIO_CELL), so that it applies only to the rates and channel
+ * counts of the descriptors which carry it: the bit depths for LPCM, the
+ * maximum bit rate (in units of 8 kbps) for formats 2-8, and the format
+ * dependent value otherwise.  speakers is the speaker allocation payload.
+ */
+struct edid_audio_caps {
+    uint64_t format[EDID_AUDIO_FORMATS];
+    uint64_t extended[EDID_AUDIO_EXTENDED_FORMATS];
+    uint8_t  detail[EDID_AUDIO_FORMATS][EDID_AUDIO_CELLS];
+    uint8_t  extended_detail[EDID_AUDIO_EXTENDED_FORMATS][EDID_AUDIO_CELLS];
+    uint16_t speakers;
+};
+
+enum edid_speaker {
+    EDID_SPEAKER_NONE,
+    EDID_SPEAKER_FL,                            /* front left */
+    EDID_SPEAKER_FR,                            /* front right */
+    EDID_SPEAKER_LFE,                           /* low frequency effects */
+    EDID_SPEAKER_FC,                            /* front center */
+    EDID_SPEAKER_RL,                            /* rear left */
+    EDID_SPEAKER_RR,                            /* rear right */
+    EDID_SPEAKER_RC,                            /* rear center */
+    EDID_SPEAKER_FLC,                           /* front left center */
+    EDID_SPEAKER_FRC,                           /* front right center */
+    EDID_SPEAKER_RLC,                           /* rear left center */
+    EDID_SPEAKER_RRC,                           /* rear right center */
+};
+
+/*!
+ * A CEA-861 channel allocation: the speaker driven by each of the eight LPCM
+ * channel slots.  allocation is the value to program into the CA field of the
+ * audio InfoFrame.
+ */
+struct edid_audio_channel_map {
+    uint8_t allocation;
+    uint8_t channels;
+    uint8_t lfe;
+    uint8_t speaker[8];
+};
+
+/*!
+ * Collect the short audio descriptors and speaker allocations of every CEA-861
+ * extension present in \p length into \p caps.  Basic audio support is
+ * recorded as 2-channel 16-bit LPCM at 32, 44.1 and 48 kHz.  Returns false if
+ * \p data is not an EDID.
+ */
+bool
+edid_audio_caps_decode(struct edid_audio_caps *caps, const uint8_t *data,
+                       size_t length);
+
+/*! capabilities common to all of the \p count sinks in \p sinks */
+void
+edid_audio_caps_intersect(struct edid_audio_caps *caps,
+                          const struct edid_audio_caps *sinks, size_t count);
+
+/*!
+ * The channel allocation with the most channels which only uses speakers in
+ * the speaker allocation \p speakers.
+ */
+const struct edid_audio_channel_map *
+edid_audio_channel_map(uint16_t speakers);
+
+/*! maximum number of channels of \p format at \p rate, 0 if unsupported */
+static inline uint8_t
+edid_audio_caps_channels(const struct edid_audio_caps * const caps,
+                         const uint8_t format,
+                         const enum edid_audio_sample_rate rate)
+{
+    const uint8_t channels = caps->format[format & 0xf] >> (rate << 3);
+    return channels ? 32 - __builtin_clz(channels) : 0;
+}
+
+/*! mask of the rates at which \p format can carry \p channels channels */
+static inline uint8_t
+edid_audio_caps_rates(const struct edid_audio_caps * const caps,
+                      const uint8_t format, const uint8_t channels)
+{
+    const uint64_t matrix = caps->format[format & 0xf];
+    uint8_t rates = 0;
+
+    if (!channels || channels > 8)
+        return 0;
+
+    for (uint8_t rate = 0; rate < EDID_AUDIO_SAMPLE_RATES; rate++)
+        if (matrix & (1ull << EDID_AUDIO_CELL(rate, channels)))
+            rates |= 1 << rate;
+
+    return rates;
+}
+
+/*!
+ * The descriptor detail of \p format with \p channels channels at \p rate:
+ * for LPCM the mask of bit depths which are supported in that combination.
+ */
+static inline uint8_t
+edid_audio_caps_detail(const struct edid_audio_caps * const caps,
+                       const uint8_t format,
+                       const enum edid_audio_sample_rate rate,
+                       const uint8_t channels)
+{
+    if (!channels || channels > 8 || rate >= EDID_AUDIO_SAMPLE_RATES)
+        return 0;
+    return caps->detail[format & 0xf][EDID_AUDIO_CELL(rate, channels)];
+}
+
+#endif
+
@@ -0,0 +1,508 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(HAVE_LINUX_IO_URING_H)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#endif
+
+#include "bulk.h"
+
+enum {
+    BULK_OP_OPEN,
+    BULK_OP_READ,
+    BULK_OP_CLOSE,
+    BULK_OPS,
+};
+
+struct request {
+    ssize_t opened;
+    ssize_t result;
+    uint8_t pending;                            /* outstanding completions */
+};
+
+#if defined(HAVE_LINUX_IO_URING_H)
+struct ring {
+    int                 fd;
+    void                *mapping;
+    size_t              mapping_size;
+    struct io_uring_sqe *sqes;
+    size_t              sqes_size;
+
+    unsigned            *sq_head;
+    unsigned            *sq_tail;
+    unsigned            sq_mask;
+    unsigned            *sq_array;
+
+    unsigned            *cq_head;
+    unsigned            *cq_tail;
+    unsigned            cq_mask;
+    struct io_uring_cqe *cqes;
+};
+#endif
+
+struct eds_bulk_reader {
+    size_t         depth;
+    size_t         size;
+    uint8_t        *buffers;
+    struct request *requests;
+
+    bool           uring;
+#if defined(HAVE_LINUX_IO_URING_H)
+    struct ring    ring;
+#endif
+};
+
+/* read all of \p path, growing the buffer as needed */
+static ssize_t
+_read_all(const char * const path, uint8_t ** const data)
+{
+    size_t size = EDS_BULK_DEFAULT_SIZE;
+    ssize_t length = 0, rv;
+    uint8_t *buffer = NULL;
+    int fd;
+
+    *data = NULL;
+
+    if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0)
+        return -errno;
+
+    if (!(buffer = malloc(size))) {
+        close(fd);
+        return -ENOMEM;
+    }
+
+    for (;;) {
+        if ((size_t) length == size) {
+            uint8_t * const grown = realloc(buffer, size << 1);
+
+            if (!grown) {
+                length = -ENOMEM;
+                break;
+            }
+            buffer = grown;
+            size = size << 1;
+        }
+
+        if ((rv = read(fd, buffer + length, size - length)) < 0) {
+            if (errno == EINTR)
+                continue;
+            length = -errno;
+            break;
+        }
+        if (rv == 0)
+            break;
+        length += rv;
+    }
+
+    close(fd);
+
+    if (length < 0)
+        free(buffer);
+    else
+        *data = buffer;
+
+    return length;
+}
+
+static ssize_t
+_read(const char * const path, uint8_t * const buffer, const size_t size)
+{
+    ssize_t length = 0, rv;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0)
+        return -errno;
+
+    while ((size_t) length < size) {
+        if ((rv = read(fd, buffer + length, size - length)) < 0) {
+            if (errno == EINTR)
+                continue;
+            length = -errno;
+            break;
+        }
+        if (rv == 0)
+            break;
+        length += rv;
+    }
+
+    close(fd);
+    return length;
+}
+
+static void
+_deliver(const struct eds_bulk_reader * const reader, const char * const path,
+         const size_t index, const uint8_t * const buffer, const ssize_t length,
+         const eds_bulk_callback callback, void * const context)
+{
+    uint8_t *data;
+    ssize_t full;
+
+    if (length < 0 || (size_t) length < reader->size) {
+        callback(context, index, buffer, length);
+        return;
+    }
+
+    /* the buffer was filled, the file may be larger */
+    full = _read_all(path, &data);
+    callback(context, index, data, full);
+    free(data);
+}
+
+#if defined(HAVE_LINUX_IO_URING_H)
+static bool
+_ring_setup(struct eds_bulk_reader * const reader)
+{
+    struct ring * const ring = &reader->ring;
+    struct io_uring_params params;
+    struct iovec *iov = NULL;
+    int *files = NULL;
+    bool rv = false;
+
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(*ring));
+    ring->mapping = MAP_FAILED;
+    ring->sqes = MAP_FAILED;
+
+    if ((ring->fd = syscall(__NR_io_uring_setup, reader->depth * BULK_OPS,
+                            &params)) < 0)
+        return false;
+
+    /* linked requests on direct descriptors need Linux 5.17 */
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) ||
+        !(params.features & IORING_FEAT_LINKED_FILE))
+        goto out;
+
+    ring->mapping_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    if (ring->mapping_size < params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe))
+        ring->mapping_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    ring->mapping = mmap(NULL, ring->mapping_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->mapping == MAP_FAILED)
+        goto out;
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+        goto out;
+
+    ring->sq_head = (unsigned *) ((uint8_t *) ring->mapping + params.sq_off.head);
+    ring->sq_tail = (unsigned *) ((uint8_t *) ring->mapping + params.sq_off.tail);
+    ring->sq_mask = *(unsigned *) ((uint8_t *) ring->mapping + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *) ((uint8_t *) ring->mapping + params.sq_off.array);
+    ring->cq_head = (unsigned *) ((uint8_t *) ring->mapping + params.cq_off.head);
+    ring->cq_tail = (unsigned *) ((uint8_t *) ring->mapping + params.cq_off.tail);
+    ring->cq_mask = *(unsigned *) ((uint8_t *) ring->mapping + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *) ((uint8_t *) ring->mapping + params.cq_off.cqes);
+
+    /* one (initially empty) direct descriptor and one buffer per request */
+    if (!(files = malloc(reader->depth * sizeof(*files))) ||
+        !(iov = malloc(reader->depth * sizeof(*iov))))
+        goto out;
+
+    for (size_t i = 0; i < reader->depth; i++) {
+        files[i] = -1;
+        iov[i].iov_base = reader->buffers + i * reader->size;
+        iov[i].iov_len = reader->size;
+    }
+
+    if (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_FILES,
+                files, reader->depth) < 0)
+        goto out;
+
+    if (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS,
+                iov, reader->depth) < 0)
+        goto out;
+
+    rv = true;
+
+out:
+    free(iov);
+    free(files);
+
+    if (!rv) {
+        if (ring->sqes != MAP_FAILED)
+            munmap(ring->sqes, ring->sqes_size);
+        if (ring->mapping != MAP_FAILED)
+            munmap(ring->mapping, ring->mapping_size);
+        close(ring->fd);
+    }
+
+    return rv;
+}
+
+static void
+_ring_teardown(struct ring * const ring)
+{
+    munmap(ring->sqes, ring->sqes_size);
+    munmap(ring->mapping, ring->mapping_size);
+    close(ring->fd);
+}
+
+static struct io_uring_sqe *
+_ring_sqe(struct ring * const ring, unsigned * const tail, const size_t slot,
+          const uint8_t op)
+{
+    struct io_uring_sqe * const sqe = &ring->sqes[*tail & ring->sq_mask];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->user_data = slot * BULK_OPS + op;
+    ring->sq_array[*tail & ring->sq_mask] = *tail & ring->sq_mask;
+    (*tail)++;
+
+    return sqe;
+}
+
+/*
+ * open -> read -> close on the direct descriptor of the slot.  The close is
+ * hard linked so that it runs even if the read fails; every request posts a
+ * completion, cancelled ones included.
+ */
+static void
+_ring_queue(struct eds_bulk_reader * const reader, const size_t slot,
+            const char * const path)
+{
+    struct ring * const ring = &reader->ring;
+    unsigned tail = *ring->sq_tail;
+    struct io_uring_sqe *sqe;
+
+    sqe = _ring_sqe(ring, &tail, slot, BULK_OP_OPEN);
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->flags = IOSQE_IO_LINK;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (uintptr_t) path;
+    sqe->open_flags = O_RDONLY;
+    sqe->file_index = slot + 1;
+
+    sqe = _ring_sqe(ring, &tail, slot, BULK_OP_READ);
+    sqe->opcode = IORING_OP_READ_FIXED;
+    sqe->flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+    sqe->fd = slot;
+    sqe->addr = (uintptr_t) (reader->buffers + slot * reader->size);
+    sqe->len = reader->size;
+    sqe->buf_index = slot;
+
+    sqe = _ring_sqe(ring, &tail, slot, BULK_OP_CLOSE);
+    sqe->opcode = IORING_OP_CLOSE;
+    sqe->file_index = slot + 1;
+
+    __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+    reader->requests[slot].opened = 0;
+    reader->requests[slot].result = 0;
+    reader->requests[slot].pending = BULK_OPS;
+}
+
+static void
+_ring_reap(struct eds_bulk_reader * const reader)
+{
+    struct ring * const ring = &reader->ring;
+    const unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    unsigned head = *ring->cq_head;
+
+    for (; head != tail; head++) {
+        const struct io_uring_cqe * const cqe = &ring->cqes[head & ring->cq_mask];
+        struct request * const request =
+            &reader->requests[cqe->user_data / BULK_OPS];
+
+        switch (cqe->user_data % BULK_OPS) {
+        case BULK_OP_OPEN:
+            request->opened = cqe->res;
+            break;
+        case BULK_OP_READ:
+            request->result = cqe->res;
+            break;
+        }
+        request->pending--;
+    }
+
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+}
+
+/*
+ * Wait out every request still owned by the kernel so that no read lands in
+ * a buffer after the caller has been handed an error.  Should the ring not
+ * even manage that, tear it down (which cancels whatever is left) and fall
+ * back to synchronous reads.
+ */
+static void
+_ring_drain(struct eds_bulk_reader * const reader, unsigned queued)
+{
+    for (;;) {
+        bool pending = false;
+        int rv;
+
+        for (size_t i = 0; i < reader->depth; i++)
+            pending = pending || reader->requests[i].pending;
+        if (!pending)
+            return;
+
+        rv = syscall(__NR_io_uring_enter, reader->ring.fd, queued, 1,
+                     IORING_ENTER_GETEVENTS, NULL, 0);
+        if (rv < 0) {
+            if (errno == EINTR)
+                continue;
+            _ring_teardown(&reader->ring);
+            reader->uring = false;
+            return;
+        }
+        queued = queued - rv;
+
+        _ring_reap(reader);
+    }
+}
+
+static int
+_ring_read(struct eds_bulk_reader * const reader, const char * const *paths,
+           const size_t count, const eds_bulk_callback callback,
+           void * const context)
+{
+    size_t submitted = 0, delivered = 0;
+    unsigned queued = 0;
+    int rv;
+
+    while (delivered < count) {
+        const size_t slot = delivered % reader->depth;
+        const struct request * const request = &reader->requests[slot];
+
+        while (submitted < count && submitted - delivered < reader->depth) {
+            _ring_queue(reader, submitted % reader->depth, paths[submitted]);
+            queued = queued + BULK_OPS;
+            submitted++;
+        }
+
+        if (submitted > delivered && !request->pending) {
+            _deliver(reader, paths[delivered], delivered,
+                     reader->buffers + slot * reader->size,
+                     request->opened < 0 ? request->opened : request->result,
+                     callback, context);
+            delivered++;
+            continue;
+        }
+
+        rv = syscall(__NR_io_uring_enter, reader->ring.fd, queued, 1,
+                     IORING_ENTER_GETEVENTS, NULL, 0);
+        if (rv < 0) {
+            if (errno == EINTR)
+                continue;
+            rv = -errno;
+            _ring_drain(reader, queued);
+            return rv;
+        }
+        queued = queued - rv;
+
+        _ring_reap(reader);
+    }
+
+    return 0;
+}
+#endif
+
+struct eds_bulk_reader *
+eds_bulk_reader_new(size_t depth, size_t size)
+{
+    struct eds_bulk_reader *reader;
+
+    if (!depth)
+        depth = EDS_BULK_DEFAULT_DEPTH;
+    if (!size)
+        size = EDS_BULK_DEFAULT_SIZE;
+
+    if (!(reader = calloc(1, sizeof(*reader))))
+        return NULL;
+
+    reader->depth = depth;
+    reader->size = size;
+
+    if (!(reader->buffers = malloc(depth * size)) ||
+        !(reader->requests = calloc(depth, sizeof(*reader->requests)))) {
+        eds_bulk_reader_free(reader);
+        return NULL;
+    }
+
+#if defined(HAVE_LINUX_IO_URING_H)
+    reader->uring = _ring_setup(reader);
+#endif
+
+    return reader;
+}
+
+void
+eds_bulk_reader_free(struct eds_bulk_reader * const reader)
+{
+    if (!reader)
+        return;
+
+#if defined(HAVE_LINUX_IO_URING_H)
+    if (reader->uring)
+        _ring_teardown(&reader->ring);
+#endif
+
+    free(reader->requests);
+    free(reader->buffers);
+    free(reader);
+}
+
+bool
+eds_bulk_reader_uring(const struct eds_bulk_reader * const reader)
+{
+    return reader->uring;
+}
+
+int
+eds_bulk_read(struct eds_bulk_reader * const reader,
+              const char * const *paths, const size_t count,
+              const eds_bulk_callback callback, void * const context)
+{
+#if defined(HAVE_LINUX_IO_URING_H)
+    if (reader->uring)
+        return _ring_read(reader, paths, count, callback, context);
+#endif
+
+    for (size_t i = 0; i < count; i++)
+        _deliver(reader, paths[i], i, reader->buffers,
+                 _read(paths[i], reader->buffers, reader->size),
+                 callback, context);
+
+    return 0;
+}
+
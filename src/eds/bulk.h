@@ -0,0 +1,89 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_bulk_h
+#define eds_bulk_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+#include "edid.h"
+
+#define EDS_BULK_DEFAULT_DEPTH                  (0x40)
+#define EDS_BULK_DEFAULT_SIZE                   (EDID_BLOCK_SIZE * (EDID_MAX_EXTENSIONS + 1))
+
+/*!
+ * Reads many small files with as few system calls as possible.  When
+ * io_uring is available the open, read and close of up to depth files are
+ * queued as linked requests on direct descriptors and read into registered
+ * buffers, so a whole window of files costs a single io_uring_enter.
+ * Otherwise each file is read with plain open/read/close.
+ *
+ * A reader is owned by one thread; threads which share a corpus each use
+ * their own reader over their share of the paths.
+ */
+struct eds_bulk_reader;
+
+/*!
+ * Called for each path, in order.  \p data holds \p length bytes and is only
+ * valid for the duration of the call; \p length is a negative errno if the
+ * file could not be read.
+ */
+typedef void (*eds_bulk_callback)(void *context, size_t index,
+                                  const uint8_t *data, ssize_t length);
+
+/*!
+ * Create a reader keeping \p depth files in flight, each read into a buffer
+ * of \p size bytes (0 for the defaults).  Files larger than \p size are read
+ * again in full.
+ */
+struct eds_bulk_reader *
+eds_bulk_reader_new(size_t depth, size_t size);
+
+void
+eds_bulk_reader_free(struct eds_bulk_reader *reader);
+
+/*! true if the reader submits through io_uring */
+bool
+eds_bulk_reader_uring(const struct eds_bulk_reader *reader);
+
+/*!
+ * Read the \p count files in \p paths, invoking \p callback for each.  Returns
+ * 0 or a negative errno if the queue failed, in which case the remaining
+ * paths are not visited.
+ */
+int
+eds_bulk_read(struct eds_bulk_reader *reader, const char * const *paths,
+              size_t count, eds_bulk_callback callback, void *context);
+
+#endif
+
@@ -0,0 +1,124 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "edid.h"
+#include "carve.h"
+
+/* the length of the EDID at \p offset, or 0 if there is none */
+static size_t
+_candidate(const uint8_t * const data, const size_t length, const size_t offset)
+{
+    const uint8_t * const base = data + offset;
+    size_t blocks;
+
+    if (length - offset < EDID_BLOCK_SIZE ||
+        memcmp(base, EDID_HEADER, sizeof(EDID_HEADER)) ||
+        !edid_verify_checksum(base))
+        return 0;
+
+    blocks = (size_t) edid_get_extensions(base) + 1;
+    if (blocks > (length - offset) / EDID_BLOCK_SIZE)
+        return 0;
+
+    for (size_t i = 1; i < blocks; i++)
+        if (!edid_verify_checksum(base + i * EDID_BLOCK_SIZE))
+            return 0;
+
+    return blocks * EDID_BLOCK_SIZE;
+}
+
+size_t
+eds_carve(const uint8_t * const data, const size_t length,
+          const eds_carve_callback callback, void * const context)
+{
+    size_t found = 0, offset = 0, extent;
+
+    if (length < EDID_BLOCK_SIZE)
+        return 0;
+
+#if defined(__SSE2__)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i ones = _mm_set1_epi8((char) 0xff);
+
+        /*
+         * Sixteen positions at a time, testing the first, fourth and last
+         * bytes of the header; the few positions which pass are compared in
+         * full.  Reads stay within the first length - 7 + 15 bytes.
+         */
+        while (offset + 16 + 7 <= length) {
+            const __m128i first = _mm_loadu_si128((const __m128i *) (data + offset));
+            const __m128i middle = _mm_loadu_si128((const __m128i *) (data + offset + 3));
+            const __m128i last = _mm_loadu_si128((const __m128i *) (data + offset + 7));
+            unsigned mask =
+                _mm_movemask_epi8(_mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(first, zero),
+                                                              _mm_cmpeq_epi8(last, zero)),
+                                                _mm_cmpeq_epi8(middle, ones)));
+            size_t next = offset + 16;
+
+            while (mask) {
+                const size_t candidate = offset + __builtin_ctz(mask);
+
+                mask &= mask - 1;
+
+                if ((extent = _candidate(data, length, candidate))) {
+                    callback(context, candidate, data + candidate, extent);
+                    found++;
+
+                    /* resume after the EDID */
+                    next = candidate + extent;
+                    break;
+                }
+            }
+
+            offset = next;
+        }
+    }
+#endif
+
+    while (offset + EDID_BLOCK_SIZE <= length) {
+        if ((extent = _candidate(data, length, offset))) {
+            callback(context, offset, data + offset, extent);
+            found++;
+            offset = offset + extent;
+        } else {
+            offset++;
+        }
+    }
+
+    return found;
+}
+
@@ -0,0 +1,159 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+
+#include "edid.h"
+#include "cea861.h"
+
+static void
+cea861_visit_data_block(const struct cea861_data_block_header * const header,
+                        const uint8_t block,
+                        const struct edid_visitor * const visitor,
+                        void * const context)
+{
+    const uint8_t length = cea861_data_block_get_length((const uint8_t *) header);
+
+    if (visitor->data_block)
+        visitor->data_block(context, block, header);
+
+    switch (cea861_data_block_get_tag((const uint8_t *) header)) {
+    case CEA861_DATA_BLOCK_TYPE_AUDIO:
+        if (visitor->short_audio_descriptor) {
+            const struct cea861_audio_data_block * const adb =
+                (struct cea861_audio_data_block *) header;
+
+            for (uint8_t i = 0; i < length / sizeof(*adb->sad); i++)
+                visitor->short_audio_descriptor(context, block, &adb->sad[i]);
+        }
+        break;
+    case CEA861_DATA_BLOCK_TYPE_VIDEO:
+        if (visitor->short_video_descriptor) {
+            const struct cea861_video_data_block * const vdb =
+                (struct cea861_video_data_block *) header;
+
+            for (uint8_t i = 0; i < length; i++)
+                visitor->short_video_descriptor(context, block, &vdb->svd[i]);
+        }
+        break;
+    case CEA861_DATA_BLOCK_TYPE_VENDOR_SPECIFIC:
+        if (visitor->vendor_specific && length >= 3)
+            visitor->vendor_specific(context, block,
+                                     (struct cea861_vendor_specific_data_block *) header);
+        break;
+    case CEA861_DATA_BLOCK_TYPE_SPEAKER_ALLOCATION:
+        if (visitor->speaker_allocation && length >= 3)
+            visitor->speaker_allocation(context, block,
+                                        (struct cea861_speaker_allocation_data_block *) header);
+        break;
+    default:
+        if (visitor->unknown_data_block)
+            visitor->unknown_data_block(context, block, header);
+        break;
+    }
+}
+
+bool
+cea861_layout(const struct cea861_timing_block * const ctb, uint8_t * const end,
+              uint8_t * const dtds)
+{
+    const uint8_t offset = offsetof(struct cea861_timing_block, data);
+    const uint8_t limit = offsetof(struct cea861_timing_block, checksum);
+    const uint8_t * const block = (const uint8_t *) ctb;
+    const uint8_t dtd_offset = cea861_timing_block_get_dtd_offset(block);
+    uint8_t index;
+
+    *end = offset;
+    *dtds = 0;
+
+    if (dtd_offset < offset || dtd_offset >= limit)
+        return false;
+
+    if (cea861_timing_block_get_revision(block) >= 3) {
+        for (index = offset; index < dtd_offset; ) {
+            const uint8_t length = cea861_data_block_get_length(&block[index]);
+
+            if (index + sizeof(struct cea861_data_block_header) + length > dtd_offset)
+                break;
+
+            index = index + sizeof(struct cea861_data_block_header) + length;
+        }
+        *end = index;
+    }
+
+    for (index = dtd_offset;
+         index + sizeof(struct edid_detailed_timing_descriptor) <= limit &&
+         edid_detailed_timing_get_pixel_clock(&block[index]);
+         index = index + sizeof(struct edid_detailed_timing_descriptor))
+        ++*dtds;
+
+    return true;
+}
+
+void
+cea861_visit_layout(const struct cea861_timing_block * const ctb,
+                    const uint8_t block, const uint8_t end, const uint8_t dtds,
+                    const struct edid_visitor * const visitor,
+                    void * const context)
+{
+    const uint8_t * const data = (const uint8_t *) ctb;
+    const struct edid_detailed_timing_descriptor *dtd;
+
+    if (visitor->data_block || visitor->short_audio_descriptor ||
+        visitor->short_video_descriptor || visitor->vendor_specific ||
+        visitor->speaker_allocation || visitor->unknown_data_block) {
+        for (uint8_t index = offsetof(struct cea861_timing_block, data);
+             index < end;
+             index = index + sizeof(struct cea861_data_block_header) +
+                     cea861_data_block_get_length(&data[index]))
+            cea861_visit_data_block((struct cea861_data_block_header *) &data[index],
+                                    block, visitor, context);
+    }
+
+    if (!visitor->detailed_timing)
+        return;
+
+    dtd = (struct edid_detailed_timing_descriptor *)
+              (data + cea861_timing_block_get_dtd_offset(data));
+    for (uint8_t i = 0; i < dtds; i++)
+        visitor->detailed_timing(context, block, &dtd[i]);
+}
+
+void
+cea861_visit(const struct cea861_timing_block * const ctb, const uint8_t block,
+             const struct edid_visitor * const visitor, void * const context)
+{
+    uint8_t end, dtds;
+
+    if (!cea861_layout(ctb, &end, &dtds))
+        return;
+
+    cea861_visit_layout(ctb, block, end, dtds, visitor, context);
+}
@@ -44,6 +44,12 @@ enum cea861_data_block_type {
     CEA861_DATA_BLOCK_TYPE_EXTENDED,
 };
 
+enum cea861_extended_data_block_type {
+    CEA861_EXTENDED_DATA_BLOCK_TYPE_VIDEO_CAPABILITY        = 0x00,
+    CEA861_EXTENDED_DATA_BLOCK_TYPE_COLORIMETRY             = 0x05,
+    CEA861_EXTENDED_DATA_BLOCK_TYPE_HDR_STATIC_METADATA     = 0x06,
+};
+
 enum cea861_audio_format {
     CEA861_AUDIO_FORMAT_RESERVED,
     CEA861_AUDIO_FORMAT_LPCM,
@@ -183,73 +189,65 @@ static const struct cea861_timing {
     const double   vfreq;
     const double   pixclk;
 } cea861_timings[] = {
-    [1]  = {  640,  480, PROGRESSIVE,  800,  160,  525, 45.0,  31.469,  59.940,  25.175 },
-    [2]  = {  720,  480, PROGRESSIVE,  858,  138,  525, 45.0,  31.469,  59.940,  27.000 },
-    [3]  = {  720,  480, PROGRESSIVE,  858,  138,  525, 45.0,  31.469,  59.940,  27.000 },
-    [4]  = { 1280,  720, PROGRESSIVE, 1650,  370,  750, 30.0,  45.000,  60.000,  74.250 },
-    [5]  = { 1920, 1080,  INTERLACED, 2200,  280, 1125, 22.5,  33.750,  60.000,  72.250 },
-    [6]  = { 1440,  480,  INTERLACED, 1716,  276,  525, 22.5,  15.734,  59.940,  27.000 },
-    [7]  = { 1440,  480,  INTERLACED, 1716,  276,  525, 22.5,  15.734,  59.940,  27.000 },
-    [8]  = { 1440,  240, PROGRESSIVE, 1716,  276,  262, 22.0,  15.734,  60.054,  27.000 },  /* 9 */
-    [9]  = { 1440,  240, PROGRESSIVE, 1716,  276,  262, 22.0,  15.734,  59.826,  27.000 },  /* 8 */
-    [10] = { 2880,  480,  INTERLACED, 3432,  552,  525, 22.5,  15.734,  59.940,  54.000 },
-    [11] = { 2880,  480,  INTERLACED, 3432,  552,  525, 22.5,  15.734,  59.940,  54.000 },
-    [12] = { 2880,  240, PROGRESSIVE, 3432,  552,  262, 22.0,  15.734,  60.054,  54.000 },  /* 13 */
-    [13] = { 2880,  240, PROGRESSIVE, 3432,  552,  262, 22.0,  15.734,  59.826,  54.000 },  /* 12 */
-    [14] = { 1440,  480, PROGRESSIVE, 1716,  276,  525, 45.0,  31.469,  59.940,  54.000 },
-    [15] = { 1440,  480, PROGRESSIVE, 1716,  276,  525, 45.0,  31.469,  59.940,  54.000 },
-    [16] = { 1920, 1080, PROGRESSIVE, 2200,  280, 1125, 45.0,  67.500,  60.000, 148.500 },
-    [17] = {  720,  576, PROGRESSIVE,  864,  144,  625, 49.0,  31.250,  50.000,  27.000 },
-    [18] = {  720,  576, PROGRESSIVE,  864,  144,  625, 49.0,  31.250,  50.000,  27.000 },
-    [19] = { 1280,  720, PROGRESSIVE, 1980,  700,  750, 30.0,  37.500,  50.000,  74.250 },
-    [20] = { 1920, 1080,  INTERLACED, 2640,  720, 1125, 22.5,  28.125,  50.000,  74.250 },
-    [21] = { 1440,  576,  INTERLACED, 1728,  288,  625, 24.5,  15.625,  50.000,  27.000 },
-    [22] = { 1440,  576,  INTERLACED, 1728,  288,  625, 24.5,  15.625,  50.000,  27.000 },
-    [23] = { 1440,  288, PROGRESSIVE, 1728,  288,  312, 24.0,  15.625,  50.080,  27.000 },  /* 24 */
-    [24] = { 1440,  288, PROGRESSIVE, 1728,  288,  313, 25.0,  15.625,  49.920,  27.000 },  /* 23 */
- // [24] = { 1440,  288, PROGRESSIVE, 1728,  288,  314, 26.0,  15.625,  49.761,  27.000 },
-    [25] = { 2880,  576,  INTERLACED, 3456,  576,  625, 24.5,  15.625,  50.000,  54.000 },
-    [26] = { 2880,  576,  INTERLACED, 3456,  576,  625, 24.5,  15.625,  50.000,  54.000 },
-    [27] = { 2880,  288, PROGRESSIVE, 3456,  576,  312, 24.0,  15.625,  50.080,  54.000 },  /* 28 */
-    [28] = { 2880,  288, PROGRESSIVE, 3456,  576,  313, 25.0,  15.625,  49.920,  54.000 },  /* 27 */
- // [28] = { 2880,  288, PROGRESSIVE, 3456,  576,  314, 26.0,  15.625,  49.761,  54.000 },
-    [29] = { 1440,  576, PROGRESSIVE, 1728,  288,  625, 49.0,  31.250,  50.000,  54.000 },
-    [30] = { 1440,  576, PROGRESSIVE, 1728,  288,  625, 49.0,  31.250,  50.000,  54.000 },
-    [31] = { 1920, 1080, PROGRESSIVE, 2640,  720, 1125, 45.0,  56.250,  50.000, 148.500 },
-    [32] = { 1920, 1080, PROGRESSIVE, 2750,  830, 1125, 45.0,  27.000,  24.000,  74.250 },
-    [33] = { 1920, 1080, PROGRESSIVE, 2640,  720, 1125, 45.0,  28.125,  25.000,  74.250 },
-    [34] = { 1920, 1080, PROGRESSIVE, 2200,  280, 1125, 45.0,  33.750,  30.000,  74.250 },
-    [35] = { 2880,  480, PROGRESSIVE, 3432,  552,  525, 45.0,  31.469,  59.940, 108.500 },
-    [36] = { 2880,  480, PROGRESSIVE, 3432,  552,  525, 45.0,  31.469,  59.940, 108.500 },
-    [37] = { 2880,  576, PROGRESSIVE, 3456,  576,  625, 49.0,  31.250,  50.000, 108.000 },
-    [38] = { 2880,  576, PROGRESSIVE, 3456,  576,  625, 49.0,  31.250,  50.000, 108.000 },
-    [39] = { 1920, 1080,  INTERLACED, 2304,  384, 1250, 85.0,  31.250,  50.000,  72.000 },
-    [40] = { 1920, 1080,  INTERLACED, 2640,  720, 1125, 22.5,  56.250, 100.000, 148.500 },
-    [41] = { 1280,  720, PROGRESSIVE, 1980,  700,  750, 30.0,  75.000, 100.000, 148.500 },
-    [42] = {  720,  576, PROGRESSIVE,  864,  144,  625, 49.0,  62.500, 100.000,  54.000 },
-    [43] = {  720,  576, PROGRESSIVE,  864,  144,  625, 49.0,  62.500, 100.000,  54.000 },
-    [44] = { 1440,  576,  INTERLACED, 1728,  288,  625, 24.5,  31.250, 100.000,  54.000 },
-    [45] = { 1440,  576,  INTERLACED, 1728,  288,  625, 24.5,  31.250, 100.000,  54.000 },
-    [46] = { 1920, 1080,  INTERLACED, 2200,  280, 1125, 22.5,  67.500, 120.000, 148.500 },
-    [47] = { 1280,  720, PROGRESSIVE, 1650,  370,  750, 30.0,  90.000, 120.000, 148.500 },
-    [48] = {  720,  480, PROGRESSIVE,  858,  138,  525, 45.0,  62.937, 119.880,  54.000 },
-    [49] = {  720,  480, PROGRESSIVE,  858,  138,  525, 45.0,  62.937, 119.880,  54.000 },
-    [50] = { 1440,  480,  INTERLACED, 1716,  276,  525, 22.5,  31.469, 119.880,  54.000 },
-    [51] = { 1440,  480,  INTERLACED, 1716,  276,  525, 22.5,  31.469, 119.880,  54.000 },
-    [52] = {  720,  576, PROGRESSIVE,  864,  144,  625, 49.0, 125.000, 200.000, 108.000 },
-    [53] = {  720,  576, PROGRESSIVE,  864,  144,  625, 49.0, 125.000, 200.000, 108.000 },
-    [54] = { 1440,  576,  INTERLACED, 1728,  288,  625, 24.5,  62.500, 200.000, 108.000 },
-    [55] = { 1440,  576,  INTERLACED, 1728,  288,  625, 24.5,  62.500, 200.000, 108.000 },
-    [56] = {  720,  480, PROGRESSIVE,  858,  138,  525, 45.0, 125.874, 239.760, 108.000 },
-    [57] = {  720,  480, PROGRESSIVE,  858,  138,  525, 45.0, 125.874, 239.760, 108.000 },
-    [58] = { 1440,  480,  INTERLACED, 1716,  276,  525, 22.5,  62.937, 239.760, 108.000 },
-    [59] = { 1440,  480,  INTERLACED, 1716,  276,  525, 22.5,  62.937, 239.760, 108.000 },
-    [60] = { 1280,  720, PROGRESSIVE, 3300, 2020,  750, 30.0,  18.000,  24.000,  59.400 },
-    [61] = { 1280,  720, PROGRESSIVE, 3960, 2680,  750, 30.0,  18.750,  25.000,  74.250 },
-    [62] = { 1280,  720, PROGRESSIVE, 3300, 2020,  750, 30.0,  22.500,  30.000,  74.250 },
-    [63] = { 1920, 1080, PROGRESSIVE, 2200,  280, 1125, 45.0, 135.000, 120.000, 297.000 },
-    [64] = { 1920, 1080, PROGRESSIVE, 2640,  720, 1125, 45.0, 112.500, 100.000, 297.000 },
+#define CEA861_TIMING(vic, hactive, vactive, mode, htotal, hblank, vtotal,      \
+                      vblank, hfreq, vfreq, pixclk)                             \
+    [vic] = { hactive, vactive, mode, htotal, hblank, vtotal, vblank, hfreq,    \
+              vfreq, pixclk },
+#include "cea861-timings.def"
+#undef CEA861_TIMING
 };
 
+/*!
+ * The VIC of a short video descriptor (CTA-861-F 7.5.1).  Only codes 129-192
+ * carry the native flag, over VICs 1-64; every other code is the VIC itself.
+ * The reserved codes 0, 128, 254 and 255 yield 0.
+ */
+static inline uint8_t
+cea861_short_video_descriptor_vic(const struct cea861_short_video_descriptor * const svd)
+{
+    const uint8_t code = *(const uint8_t *) svd;
+
+    if (code == 0x00 || code == 0x80 || code >= 0xfe)
+        return 0;
+    return code > 0x80 && code <= 0xc0 ? code & 0x7f : code;
+}
+
+static inline bool
+cea861_short_video_descriptor_native(const struct cea861_short_video_descriptor * const svd)
+{
+    const uint8_t code = *(const uint8_t *) svd;
+
+    return code > 0x80 && code <= 0xc0;
+}
+
+struct edid_visitor;
+
+/*!
+ * Walk a CEA-861 timing extension, invoking the data block and detailed timing
+ * callbacks of the visitor.  block is the index of the extension in the EDID.
+ */
+void
+cea861_visit(const struct cea861_timing_block *ctb, uint8_t block,
+             const struct edid_visitor *visitor, void *context);
+
+/*!
+ * Establish the extent of a CEA-861 timing extension: \p end is the offset
+ * just past the last data block which lies wholly before the DTDs and \p dtds
+ * the number of DTDs which fit before the checksum.  Returns false, with both
+ * empty, if the DTD offset is out of range.
+ */
+bool
+cea861_layout(const struct cea861_timing_block *ctb, uint8_t *end,
+              uint8_t *dtds);
+
+/*!
+ * cea861_visit over an extent already established by cea861_layout, without
+ * checking it again.
+ */
+void
+cea861_visit_layout(const struct cea861_timing_block *ctb, uint8_t block,
+                    uint8_t end, uint8_t dtds,
+                    const struct edid_visitor *visitor, void *context);
+
 #endif
 
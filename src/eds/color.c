@@ -0,0 +1,573 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "edid.h"
+#include "cea861.h"
+#include "color.h"
+
+/* SMPTE ST 2084 */
+#define PQ_M1                                   (2610.0f / 16384.0f)
+#define PQ_M2                                   (2523.0f / 4096.0f * 128.0f)
+#define PQ_C1                                   (3424.0f / 4096.0f)
+#define PQ_C2                                   (2413.0f / 4096.0f * 32.0f)
+#define PQ_C3                                   (2392.0f / 4096.0f * 32.0f)
+
+/* ITU-R BT.2100 */
+#define HLG_A                                   (0.17883277f)
+#define HLG_B                                   (0.28466892f)
+#define HLG_C                                   (0.55991073f)
+
+static bool
+_invert(const double m[9], double inverse[9])
+{
+    const double c0 = m[4] * m[8] - m[5] * m[7];
+    const double c1 = m[5] * m[6] - m[3] * m[8];
+    const double c2 = m[3] * m[7] - m[4] * m[6];
+    const double determinant = m[0] * c0 + m[1] * c1 + m[2] * c2;
+
+    if (fabs(determinant) < 1e-12)
+        return false;
+
+    inverse[0] = c0 / determinant;
+    inverse[1] = (m[2] * m[7] - m[1] * m[8]) / determinant;
+    inverse[2] = (m[1] * m[5] - m[2] * m[4]) / determinant;
+    inverse[3] = c1 / determinant;
+    inverse[4] = (m[0] * m[8] - m[2] * m[6]) / determinant;
+    inverse[5] = (m[2] * m[3] - m[0] * m[5]) / determinant;
+    inverse[6] = c2 / determinant;
+    inverse[7] = (m[1] * m[6] - m[0] * m[7]) / determinant;
+    inverse[8] = (m[0] * m[4] - m[1] * m[3]) / determinant;
+
+    return true;
+}
+
+/* S31.32 sign-magnitude */
+static inline uint64_t
+_fixed(const double value)
+{
+    const uint64_t magnitude = (uint64_t) llround(fabs(value) * 4294967296.0);
+
+    return value < 0 ? magnitude | UINT64_C(1) << 63 : magnitude;
+}
+
+struct _hdr_static_metadata {
+    const uint8_t *block;
+    uint8_t       length;
+};
+
+static void
+_data_block(void * const context, const uint8_t block,
+            const struct cea861_data_block_header * const header)
+{
+    struct _hdr_static_metadata * const metadata = context;
+    const uint8_t * const data = (const uint8_t *) header;
+    const uint8_t length = cea861_data_block_get_length(data);
+
+    (void) block;
+
+    if (metadata->block || length < 3 ||
+        cea861_data_block_get_tag(data) != CEA861_DATA_BLOCK_TYPE_EXTENDED ||
+        cea861_data_block_get_extended_tag(data) != CEA861_EXTENDED_DATA_BLOCK_TYPE_HDR_STATIC_METADATA)
+        return;
+
+    metadata->block = data;
+    metadata->length = length;
+}
+
+static const struct edid_visitor _hdr_visitor = {
+    .data_block = _data_block,
+};
+
+bool
+edid_color_decode(struct edid_color * const color, const uint8_t * const data,
+                  const size_t length)
+{
+    struct edid_color_characteristics_data characteristics;
+    struct _hdr_static_metadata metadata = { NULL, 0 };
+    const double (*primaries[3])[2];
+    double m[9], inverse[9], w[3], s[3];
+
+    memset(color, 0, sizeof(*color));
+
+    if (length < EDID_BLOCK_SIZE)
+        return false;
+
+    characteristics = edid_color_characteristics((const struct edid *) data);
+
+    color->red[0] = characteristics.red.x / 1024.0;
+    color->red[1] = characteristics.red.y / 1024.0;
+    color->green[0] = characteristics.green.x / 1024.0;
+    color->green[1] = characteristics.green.y / 1024.0;
+    color->blue[0] = characteristics.blue.x / 1024.0;
+    color->blue[1] = characteristics.blue.y / 1024.0;
+    color->white[0] = characteristics.white.x / 1024.0;
+    color->white[1] = characteristics.white.y / 1024.0;
+
+    /* 0xff indicates that the gamma is given elsewhere; assume sRGB's */
+    color->gamma = edid_get_display_transfer_characteristics(data) == 0xff
+                 ? 2.2f : (float) edid_gamma((const struct edid *) data);
+
+    color->eotfs = EDID_COLOR_EOTF_MASK(EDID_COLOR_EOTF_SDR);
+    color->eotf = EDID_COLOR_EOTF_SDR;
+
+    if (edid_visit(data, length, &_hdr_visitor, &metadata, NULL) && metadata.block) {
+        const uint8_t * const block = metadata.block;
+        const uint8_t eotfs =
+            cea861_hdr_static_metadata_data_block_get_eotfs(block);
+
+        /* bit 2 is ST 2084 and bit 3 HLG */
+        if (eotfs & (1 << 2))
+            color->eotfs |= EDID_COLOR_EOTF_MASK(EDID_COLOR_EOTF_PQ);
+        if (eotfs & (1 << 3))
+            color->eotfs |= EDID_COLOR_EOTF_MASK(EDID_COLOR_EOTF_HLG);
+
+        if (color->eotfs & EDID_COLOR_EOTF_MASK(EDID_COLOR_EOTF_PQ))
+            color->eotf = EDID_COLOR_EOTF_PQ;
+        else if (color->eotfs & EDID_COLOR_EOTF_MASK(EDID_COLOR_EOTF_HLG))
+            color->eotf = EDID_COLOR_EOTF_HLG;
+
+        if (metadata.length >= 4)
+            color->max_luminance = 50.0f *
+                exp2f(cea861_hdr_static_metadata_data_block_get_max_luminance(block) / 32.0f);
+        if (metadata.length >= 5)
+            color->max_frame_average_luminance = 50.0f *
+                exp2f(cea861_hdr_static_metadata_data_block_get_max_frame_average_luminance(block) / 32.0f);
+        if (metadata.length >= 6 && color->max_luminance > 0.0f) {
+            const float cv =
+                cea861_hdr_static_metadata_data_block_get_min_luminance(block) / 255.0f;
+
+            color->min_luminance = color->max_luminance * cv * cv / 100.0f;
+        }
+    }
+
+    /* XYZ of each primary at Y = 1, scaled so that they sum to the white */
+    primaries[0] = &color->red;
+    primaries[1] = &color->green;
+    primaries[2] = &color->blue;
+
+    for (unsigned i = 0; i < 3; i++) {
+        const double x = (*primaries[i])[0], y = (*primaries[i])[1];
+
+        if (y <= 0.0)
+            return false;
+
+        m[0 + i] = x / y;
+        m[3 + i] = 1.0;
+        m[6 + i] = (1.0 - x - y) / y;
+    }
+
+    if (color->white[1] <= 0.0)
+        return false;
+
+    w[0] = color->white[0] / color->white[1];
+    w[1] = 1.0;
+    w[2] = (1.0 - color->white[0] - color->white[1]) / color->white[1];
+
+    if (!_invert(m, inverse))
+        return false;
+
+    for (unsigned i = 0; i < 3; i++)
+        s[i] = inverse[3 * i + 0] * w[0] + inverse[3 * i + 1] * w[1] +
+               inverse[3 * i + 2] * w[2];
+
+    for (unsigned i = 0; i < 9; i++)
+        m[i] = m[i] * s[i % 3];
+
+    if (!_invert(m, inverse))
+        return false;
+
+    for (unsigned i = 0; i < 9; i++) {
+        color->rgb_to_xyz[i] = m[i];
+        color->xyz_to_rgb[i] = inverse[i];
+        color->rgb_to_xyz_fixed[i] = _fixed(m[i]);
+        color->xyz_to_rgb_fixed[i] = _fixed(inverse[i]);
+    }
+
+    return true;
+}
+
+/* transfer functions over [0, 1] */
+
+static inline float
+_transfer(const float x, const enum edid_color_eotf eotf, const bool inverse,
+          const float gamma)
+{
+    float p;
+
+    switch (eotf) {
+    case EDID_COLOR_EOTF_PQ:
+        if (inverse) {
+            p = powf(x, PQ_M1);
+            return powf((PQ_C1 + PQ_C2 * p) / (1.0f + PQ_C3 * p), PQ_M2);
+        }
+        p = powf(x, 1.0f / PQ_M2);
+        return powf(fmaxf(p - PQ_C1, 0.0f) / (PQ_C2 - PQ_C3 * p), 1.0f / PQ_M1);
+    case EDID_COLOR_EOTF_HLG:
+        if (inverse)
+            return x <= 1.0f / 12.0f ? sqrtf(3.0f * x)
+                                     : HLG_A * logf(12.0f * x - HLG_B) + HLG_C;
+        return x <= 0.5f ? x * x / 3.0f
+                         : (expf((x - HLG_C) / HLG_A) + HLG_B) / 12.0f;
+    case EDID_COLOR_EOTF_SDR:
+    default:
+        return powf(x, inverse ? 1.0f / gamma : gamma);
+    }
+}
+
+static inline uint16_t
+_quantise(const float value)
+{
+    if (!(value > 0.0f))
+        return 0;
+    if (value >= 1.0f)
+        return 0xffff;
+    return (uint16_t) (value * 65535.0f + 0.5f);
+}
+
+#if defined(__SSE2__)
+/*
+ * Four lanes of log2 and exp2, good to a few ulp over the range the LUTs
+ * need, so that a table is a straight loop over vectors rather than a libm
+ * call per entry.
+ */
+static inline __m128
+_log2_ps(const __m128 x)
+{
+    const __m128i bits = _mm_castps_si128(x);
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128i exponent = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)),
+                                             _mm_castps_si128(one)));
+    const __m128 large = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+    __m128 s, s2, series;
+
+    /* centre the mantissa on 1 */
+    m = _mm_or_ps(_mm_and_ps(large, _mm_mul_ps(m, _mm_set1_ps(0.5f))),
+                  _mm_andnot_ps(large, m));
+    exponent = _mm_sub_epi32(exponent, _mm_castps_si128(large));
+
+    /* ln(m) = 2 atanh((m - 1) / (m + 1)) */
+    s = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+    s2 = _mm_mul_ps(s, s);
+    series = _mm_set1_ps(1.0f / 9.0f);
+    series = _mm_add_ps(_mm_mul_ps(series, s2), _mm_set1_ps(1.0f / 7.0f));
+    series = _mm_add_ps(_mm_mul_ps(series, s2), _mm_set1_ps(1.0f / 5.0f));
+    series = _mm_add_ps(_mm_mul_ps(series, s2), _mm_set1_ps(1.0f / 3.0f));
+    series = _mm_add_ps(_mm_mul_ps(series, s2), one);
+
+    return _mm_add_ps(_mm_cvtepi32_ps(exponent),
+                      _mm_mul_ps(_mm_mul_ps(s, series), _mm_set1_ps(2.0f * 1.44269504f)));
+}
+
+static inline __m128
+_exp2_ps(__m128 y)
+{
+    __m128i n;
+    __m128 t, p;
+
+    y = _mm_min_ps(_mm_max_ps(y, _mm_set1_ps(-126.0f)), _mm_set1_ps(127.0f));
+    n = _mm_cvtps_epi32(y);
+    t = _mm_mul_ps(_mm_sub_ps(y, _mm_cvtepi32_ps(n)), _mm_set1_ps(0.69314718f));
+
+    p = _mm_set1_ps(1.0f / 5040.0f);
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.0f / 720.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.0f / 120.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.0f / 24.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.0f / 6.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(0.5f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.0f));
+
+    return _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)));
+}
+
+/* x^y for x >= 0, with 0^y = 0 */
+static inline __m128
+_pow_ps(const __m128 x, const float y)
+{
+    const __m128 zero = _mm_cmple_ps(x, _mm_setzero_ps());
+
+    return _mm_andnot_ps(zero, _exp2_ps(_mm_mul_ps(_log2_ps(x), _mm_set1_ps(y))));
+}
+
+static inline __m128
+_select_ps(const __m128 mask, const __m128 a, const __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128
+_transfer_ps(const __m128 x, const enum edid_color_eotf eotf,
+             const bool inverse, const float gamma)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 p;
+
+    switch (eotf) {
+    case EDID_COLOR_EOTF_PQ:
+        if (inverse) {
+            p = _pow_ps(x, PQ_M1);
+            return _pow_ps(_mm_div_ps(_mm_add_ps(_mm_set1_ps(PQ_C1), _mm_mul_ps(_mm_set1_ps(PQ_C2), p)),
+                                      _mm_add_ps(one, _mm_mul_ps(_mm_set1_ps(PQ_C3), p))),
+                           PQ_M2);
+        }
+        p = _pow_ps(x, 1.0f / PQ_M2);
+        return _pow_ps(_mm_div_ps(_mm_max_ps(_mm_sub_ps(p, _mm_set1_ps(PQ_C1)), _mm_setzero_ps()),
+                                  _mm_sub_ps(_mm_set1_ps(PQ_C2), _mm_mul_ps(_mm_set1_ps(PQ_C3), p))),
+                       1.0f / PQ_M1);
+    case EDID_COLOR_EOTF_HLG:
+        if (inverse) {
+            /* a ln(12x - b) + c, with the argument kept positive for the low lanes */
+            const __m128 high = _mm_mul_ps(_log2_ps(_mm_max_ps(_mm_sub_ps(_mm_mul_ps(x, _mm_set1_ps(12.0f)),
+                                                                          _mm_set1_ps(HLG_B)),
+                                                               _mm_set1_ps(1e-6f))),
+                                           _mm_set1_ps(HLG_A * 0.69314718f));
+
+            return _select_ps(_mm_cmple_ps(x, _mm_set1_ps(1.0f / 12.0f)),
+                              _mm_sqrt_ps(_mm_mul_ps(x, _mm_set1_ps(3.0f))),
+                              _mm_add_ps(high, _mm_set1_ps(HLG_C)));
+        }
+        return _select_ps(_mm_cmple_ps(x, _mm_set1_ps(0.5f)),
+                          _mm_mul_ps(_mm_mul_ps(x, x), _mm_set1_ps(1.0f / 3.0f)),
+                          _mm_mul_ps(_mm_add_ps(_exp2_ps(_mm_mul_ps(_mm_sub_ps(x, _mm_set1_ps(HLG_C)),
+                                                                    _mm_set1_ps(1.44269504f / HLG_A))),
+                                                _mm_set1_ps(HLG_B)),
+                                     _mm_set1_ps(1.0f / 12.0f)));
+    case EDID_COLOR_EOTF_SDR:
+    default:
+        return _pow_ps(x, inverse ? 1.0f / gamma : gamma);
+    }
+}
+
+/* [0, 1] to [0, 0xffff] with rounding, packed without SSE4.1's packus */
+static inline void
+_quantise_ps(const __m128 value, uint16_t * const lut)
+{
+    const __m128 clamped =
+        _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    const __m128i scaled =
+        _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(65535.0f)),
+                                                  _mm_set1_ps(0.5f))),
+                      _mm_set1_epi32(0x8000));
+    const __m128i packed =
+        _mm_xor_si128(_mm_packs_epi32(scaled, scaled), _mm_set1_epi16((short) 0x8000));
+
+    _mm_storel_epi64((__m128i *) lut, packed);
+}
+#endif
+
+void
+edid_color_lut(const struct edid_color * const color,
+               const enum edid_color_eotf eotf, const bool inverse,
+               uint16_t * const lut, const size_t size)
+{
+    const float step = size > 1 ? 1.0f / (size - 1) : 0.0f;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128 lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+
+    for (; i + 4 <= size; i = i + 4) {
+        const __m128 x =
+            _mm_mul_ps(_mm_add_ps(_mm_set1_ps((float) i), lanes), _mm_set1_ps(step));
+
+        _quantise_ps(_transfer_ps(x, eotf, inverse, color->gamma), &lut[i]);
+    }
+#endif
+    for (; i < size; i++)
+        lut[i] = _quantise(_transfer(i * step, eotf, inverse, color->gamma));
+
+    /* the ends are exact whatever the approximation */
+    if (size > 1) {
+        lut[0] = _quantise(_transfer(0.0f, eotf, inverse, color->gamma));
+        lut[size - 1] = _quantise(_transfer(1.0f, eotf, inverse, color->gamma));
+    }
+}
+
+/* pipeline cache */
+
+struct eds_color_cache {
+    size_t                    size;
+    size_t                    count;
+    size_t                    capacity;
+    uint64_t                  *keys;
+    struct eds_color_pipeline **pipelines;
+};
+
+static inline uint64_t
+_mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= UINT64_C(0xff51afd7ed558ccd);
+    value ^= value >> 33;
+    value *= UINT64_C(0xc4ceb9fe1a85ec53);
+    value ^= value >> 33;
+    return value;
+}
+
+static uint64_t
+_model_key(const uint8_t * const data, const size_t length)
+{
+    size_t blocks = (size_t) edid_get_extensions(data) + 1;
+    uint64_t hash = edid_model_fingerprint(data);
+
+    if (blocks > length / EDID_BLOCK_SIZE)
+        blocks = length / EDID_BLOCK_SIZE;
+
+    for (size_t i = EDID_BLOCK_SIZE; i < blocks * EDID_BLOCK_SIZE; i++)
+        hash = (hash ^ data[i]) * UINT64_C(0x100000001b3);
+
+    return _mix(hash);
+}
+
+struct eds_color_cache *
+eds_color_cache_new(const size_t size)
+{
+    struct eds_color_cache * const cache = calloc(1, sizeof(*cache));
+
+    if (cache)
+        cache->size = size;
+
+    return cache;
+}
+
+void
+eds_color_cache_free(struct eds_color_cache * const cache)
+{
+    if (!cache)
+        return;
+
+    for (size_t i = 0; i < cache->capacity; i++)
+        free(cache->pipelines[i]);
+
+    free(cache->keys);
+    free(cache->pipelines);
+    free(cache);
+}
+
+static bool
+_grow(struct eds_color_cache * const cache)
+{
+    const size_t capacity = cache->capacity ? cache->capacity << 1 : 16;
+    uint64_t * const keys = calloc(capacity, sizeof(*keys));
+    struct eds_color_pipeline ** const pipelines =
+        calloc(capacity, sizeof(*pipelines));
+
+    if (!keys || !pipelines) {
+        free(keys);
+        free(pipelines);
+        return false;
+    }
+
+    for (size_t i = 0; i < cache->capacity; i++) {
+        size_t slot;
+
+        if (!cache->pipelines[i])
+            continue;
+
+        slot = cache->keys[i] & (capacity - 1);
+        while (pipelines[slot])
+            slot = (slot + 1) & (capacity - 1);
+
+        keys[slot] = cache->keys[i];
+        pipelines[slot] = cache->pipelines[i];
+    }
+
+    free(cache->keys);
+    free(cache->pipelines);
+    cache->keys = keys;
+    cache->pipelines = pipelines;
+    cache->capacity = capacity;
+
+    return true;
+}
+
+const struct eds_color_pipeline *
+eds_color_cache_get(struct eds_color_cache * const cache,
+                    const uint8_t * const data, const size_t length)
+{
+    struct eds_color_pipeline *pipeline;
+    uint64_t key;
+    size_t slot;
+
+    if (length < EDID_BLOCK_SIZE)
+        return NULL;
+
+    key = _model_key(data, length);
+
+    if (cache->capacity) {
+        slot = key & (cache->capacity - 1);
+        while (cache->pipelines[slot]) {
+            if (cache->keys[slot] == key)
+                return cache->pipelines[slot];
+            slot = (slot + 1) & (cache->capacity - 1);
+        }
+    }
+
+    if ((cache->count + 1) * 2 > cache->capacity && !_grow(cache))
+        return NULL;
+
+    /* the LUTs follow the pipeline in the same allocation */
+    pipeline = malloc(sizeof(*pipeline) + 2 * cache->size * sizeof(uint16_t));
+    if (!pipeline)
+        return NULL;
+
+    if (!edid_color_decode(&pipeline->color, data, length)) {
+        free(pipeline);
+        return NULL;
+    }
+
+    pipeline->size = cache->size;
+    pipeline->degamma = (uint16_t *) (pipeline + 1);
+    pipeline->gamma = pipeline->degamma + cache->size;
+    edid_color_lut(&pipeline->color, pipeline->color.eotf, false,
+                   pipeline->degamma, cache->size);
+    edid_color_lut(&pipeline->color, pipeline->color.eotf, true,
+                   pipeline->gamma, cache->size);
+
+    slot = key & (cache->capacity - 1);
+    while (cache->pipelines[slot])
+        slot = (slot + 1) & (cache->capacity - 1);
+
+    cache->keys[slot] = key;
+    cache->pipelines[slot] = pipeline;
+    cache->count++;
+
+    return pipeline;
+}
+
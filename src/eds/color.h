@@ -0,0 +1,120 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_color_h
+#define eds_color_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+enum edid_color_eotf {
+    EDID_COLOR_EOTF_SDR,                        /* the gamma of the base block */
+    EDID_COLOR_EOTF_PQ,                         /* SMPTE ST 2084 */
+    EDID_COLOR_EOTF_HLG,                        /* ITU-R BT.2100 HLG */
+};
+
+#define EDID_COLOR_EOTF_MASK(eotf)              (1u << (eotf))
+
+/*!
+ * The colour characteristics of a display in the forms a colour pipeline
+ * consumes.  Matrices are row major and convert linear RGB to CIE XYZ and
+ * back, with the white point mapped to Y = 1.  The fixed point matrices use
+ * the S31.32 sign-magnitude format of struct drm_color_ctm.
+ *
+ * Luminances are in cd/m² and 0 when the display does not declare them.
+ */
+struct edid_color {
+    double   red[2];                            /* CIE 1931 x, y */
+    double   green[2];
+    double   blue[2];
+    double   white[2];
+    float    gamma;
+
+    float    rgb_to_xyz[9];
+    float    xyz_to_rgb[9];
+    uint64_t rgb_to_xyz_fixed[9];
+    uint64_t xyz_to_rgb_fixed[9];
+
+    uint8_t  eotfs;                             /* EDID_COLOR_EOTF_MASK bits */
+    uint8_t  eotf;                              /* the preferred eotf */
+    float    max_luminance;
+    float    max_frame_average_luminance;
+    float    min_luminance;
+};
+
+/*!
+ * Derive the colour characteristics of the EDID in \p data.  Returns false if
+ * the chromaticities do not describe a usable gamut.
+ */
+bool
+edid_color_decode(struct edid_color *color, const uint8_t *data,
+                  size_t length);
+
+/*!
+ * Fill \p lut with \p size samples of a transfer function over [0, 1],
+ * scaled to [0, 0xffff].  The EOTF maps the signal to linear light (a DRM
+ * degamma LUT); \p inverse maps linear light to the signal (a gamma LUT).
+ * Linear light is relative to 10000 cd/m² for PQ and is scene light for HLG.
+ */
+void
+edid_color_lut(const struct edid_color *color, enum edid_color_eotf eotf,
+               bool inverse, uint16_t *lut, size_t size);
+
+/*! a colour pipeline set up once per display model */
+struct eds_color_pipeline {
+    struct edid_color color;
+    size_t            size;
+    uint16_t          *degamma;                 /* EOTF of color.eotf */
+    uint16_t          *gamma;                   /* its inverse */
+};
+
+struct eds_color_cache;
+
+/*! a cache of pipelines with \p size entry LUTs */
+struct eds_color_cache *
+eds_color_cache_new(size_t size);
+
+void
+eds_color_cache_free(struct eds_color_cache *cache);
+
+/*!
+ * The pipeline for the display model of the EDID in \p data, set up on first
+ * use.  Models are told apart by edid_model_fingerprint and the extension
+ * blocks, so units of the same model share a pipeline.  The pipeline lives
+ * as long as the cache.  Returns NULL if the EDID has no usable gamut or on
+ * allocation failure.  The cache is not synchronised.
+ */
+const struct eds_color_pipeline *
+eds_color_cache_get(struct eds_color_cache *cache, const uint8_t *data,
+                    size_t length);
+
+#endif
+
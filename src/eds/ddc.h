@@ -0,0 +1,207 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_ddc_h
+#define eds_ddc_h
+
+#include <stddef.h>
+
+#include "edid.h"
+
+#define EDID_MAX_BLOCKS                         (EDID_MAX_EXTENSIONS + 1)
+
+#define EDID_EXTENSIONS_OFFSET                  (0x7e)
+#define EDID_CHECKSUM_OFFSET                    (0x7f)
+
+/*!
+ * Read \p length bytes starting at the EDID byte \p offset.  Offsets beyond the
+ * first 256 bytes require the E-DDC segment pointer to be programmed, which is
+ * left to the transport.  Returns 0 on success, a negative value on failure.
+ */
+typedef int (*edid_ddc_read_t)(void *context, uint16_t offset,
+                               uint8_t *buffer, uint8_t length);
+
+struct edid_block_mask {
+    uint32_t bits[(EDID_MAX_BLOCKS + 31) / 32];
+};
+
+static inline void
+edid_block_mask_clear(struct edid_block_mask * const mask)
+{
+    for (uint8_t i = 0; i < ARRAY_SIZE(mask->bits); i++)
+        mask->bits[i] = 0;
+}
+
+static inline void
+edid_block_mask_set(struct edid_block_mask * const mask, const uint8_t block)
+{
+    mask->bits[block >> 5] |= UINT32_C(1) << (block & 0x1f);
+}
+
+static inline void
+edid_block_mask_reset(struct edid_block_mask * const mask, const uint8_t block)
+{
+    mask->bits[block >> 5] &= ~(UINT32_C(1) << (block & 0x1f));
+}
+
+static inline bool
+edid_block_mask_test(const struct edid_block_mask * const mask,
+                     const uint8_t block)
+{
+    return mask->bits[block >> 5] & (UINT32_C(1) << (block & 0x1f));
+}
+
+/*! returns the first block at or after \p block in the mask, or -1 */
+static inline int
+edid_block_mask_next(const struct edid_block_mask * const mask,
+                     const unsigned block)
+{
+    for (unsigned i = block >> 5; i < ARRAY_SIZE(mask->bits); i++) {
+        uint32_t bits = mask->bits[i];
+
+        if (i == block >> 5)
+            bits &= ~UINT32_C(0) << (block & 0x1f);
+        if (bits)
+            return (i << 5) + __builtin_ctz(bits);
+    }
+
+    return -1;
+}
+
+/*!
+ * Cached view of the bytes which are sampled while polling.  A zero
+ * initialised state reports every block as changed on the first poll.
+ */
+struct edid_ddc_poll {
+    bool                   primed;
+    uint8_t                extensions;
+    uint8_t                checksum[EDID_MAX_BLOCKS];
+    struct edid_block_mask stale;
+};
+
+/*!
+ * Sample the extension count and the checksum byte of every block, which costs
+ * 2 + extensions bytes on the bus.  Blocks whose checksum moved (or which were
+ * added by a change in the extension count) are recorded in \p changed.  A
+ * change which preserves the checksum byte is not observable here.  An
+ * extension count beyond EDID_MAX_EXTENSIONS is clamped to it.
+ *
+ * Returns the number of changed blocks or the (negative) transport error.
+ */
+static inline int
+edid_ddc_poll(struct edid_ddc_poll * const state,
+              const edid_ddc_read_t read, void * const context,
+              struct edid_block_mask * const changed)
+{
+    uint8_t trailer[2], checksum[EDID_MAX_BLOCKS];
+    uint8_t extensions;
+    int rv, count = 0;
+
+    edid_block_mask_clear(changed);
+
+    if ((rv = read(context, EDID_EXTENSIONS_OFFSET, trailer, sizeof(trailer))))
+        return rv;
+
+    /* 0xff is not a valid count and would index past the checksums */
+    extensions = trailer[0] > EDID_MAX_EXTENSIONS ? EDID_MAX_EXTENSIONS
+                                                  : trailer[0];
+
+    checksum[0] = trailer[1];
+    for (uint16_t block = 1; block <= extensions; block++) {
+        const uint16_t offset = block * EDID_BLOCK_SIZE + EDID_CHECKSUM_OFFSET;
+
+        if ((rv = read(context, offset, &checksum[block], 1)))
+            return rv;
+    }
+
+    for (uint16_t block = 0; block <= extensions; block++) {
+        if (state->primed && block <= state->extensions &&
+            checksum[block] == state->checksum[block] &&
+            !edid_block_mask_test(&state->stale, block))
+            continue;
+
+        edid_block_mask_set(changed, block);
+        count++;
+    }
+
+    /* only commit the sample once the whole poll has succeeded */
+    for (uint16_t block = 0; block <= extensions; block++)
+        state->checksum[block] = checksum[block];
+    state->extensions = extensions;
+    state->primed = true;
+
+    return count;
+}
+
+/*!
+ * Re-fetch the blocks in \p changed into \p edid, which must be able to hold
+ * every block reported by the last poll.  A block which fails verification, or
+ * whose checksum no longer matches the polled value (the sink updated it while
+ * we were reading), is marked stale and will be reported again by the next
+ * poll; the corresponding bit is cleared from \p changed so that a consumer
+ * decodes only the blocks which were fetched successfully.
+ *
+ * Returns the number of stale blocks, -1 if \p size is too small, or the
+ * (negative) transport error.
+ */
+static inline int
+edid_ddc_refresh(struct edid_ddc_poll * const state,
+                 const edid_ddc_read_t read, void * const context,
+                 struct edid_block_mask * const changed,
+                 uint8_t * const edid, const size_t size)
+{
+    int block, rv, stale = 0;
+
+    if (size < (size_t) (state->extensions + 1) * EDID_BLOCK_SIZE)
+        return -1;
+
+    for (block = edid_block_mask_next(changed, 0);
+         block >= 0 && block <= state->extensions;
+         block = edid_block_mask_next(changed, block + 1)) {
+        uint8_t * const data = edid + block * EDID_BLOCK_SIZE;
+
+        if ((rv = read(context, block * EDID_BLOCK_SIZE, data, EDID_BLOCK_SIZE)))
+            return rv;
+
+        if (edid_verify_checksum(data) &&
+            data[EDID_CHECKSUM_OFFSET] == state->checksum[block]) {
+            edid_block_mask_reset(&state->stale, block);
+            continue;
+        }
+
+        edid_block_mask_set(&state->stale, block);
+        edid_block_mask_reset(changed, block);
+        stale++;
+    }
+
+    return stale;
+}
+
+#endif
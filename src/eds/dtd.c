@@ -0,0 +1,404 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "edid.h"
+#include "dtd.h"
+
+#define EDID_DESCRIPTOR_SIZE                    (0x12)
+
+static void
+_unpack1(struct edid_dtd_table * const table, const size_t index,
+         const uint8_t * const dtd)
+{
+    table->pixel_clock[index] = edid_detailed_timing_get_pixel_clock(dtd);
+    table->hactive[index] = edid_detailed_timing_get_horizontal_active(dtd);
+    table->hblank[index] = edid_detailed_timing_get_horizontal_blanking(dtd);
+    table->vactive[index] = edid_detailed_timing_get_vertical_active(dtd);
+    table->vblank[index] = edid_detailed_timing_get_vertical_blanking(dtd);
+    table->hsync_offset[index] = edid_detailed_timing_get_horizontal_sync_offset(dtd);
+    table->hsync_width[index] = edid_detailed_timing_get_horizontal_sync_pulse_width(dtd);
+    table->vsync_offset[index] = edid_detailed_timing_get_vertical_sync_offset(dtd);
+    table->vsync_width[index] = edid_detailed_timing_get_vertical_sync_pulse_width(dtd);
+    table->hsize[index] = edid_detailed_timing_get_horizontal_image_size(dtd);
+    table->vsize[index] = edid_detailed_timing_get_vertical_image_size(dtd);
+    table->flags[index] = dtd[0x11];
+}
+
+#if defined(__SSE2__)
+/*
+ * Unpack eight descriptors at once.  The first 16 bytes of the descriptors are
+ * transposed so that lane i of b[k] holds byte k of descriptor i, after which
+ * every field is a handful of uniform shifts, masks and ors.
+ */
+static void
+_unpack8(struct edid_dtd_table * const table, const size_t index,
+         const uint8_t * const * const dtds)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i hi_nibble = _mm_set1_epi16(0xf0);
+    const __m128i lo_nibble = _mm_set1_epi16(0x0f);
+    __m128i r[8], t[8], u[8], w[8], b[16];
+
+    for (unsigned i = 0; i < 8; i++)
+        r[i] = _mm_loadu_si128((const __m128i *) dtds[i]);
+
+    for (unsigned i = 0; i < 4; i++) {
+        t[2 * i + 0] = _mm_unpacklo_epi8(r[2 * i], r[2 * i + 1]);
+        t[2 * i + 1] = _mm_unpackhi_epi8(r[2 * i], r[2 * i + 1]);
+    }
+
+    for (unsigned i = 0; i < 2; i++) {
+        u[4 * i + 0] = _mm_unpacklo_epi16(t[4 * i + 0], t[4 * i + 2]);
+        u[4 * i + 1] = _mm_unpackhi_epi16(t[4 * i + 0], t[4 * i + 2]);
+        u[4 * i + 2] = _mm_unpacklo_epi16(t[4 * i + 1], t[4 * i + 3]);
+        u[4 * i + 3] = _mm_unpackhi_epi16(t[4 * i + 1], t[4 * i + 3]);
+    }
+
+    for (unsigned i = 0; i < 4; i++) {
+        w[2 * i + 0] = _mm_unpacklo_epi32(u[i], u[i + 4]);
+        w[2 * i + 1] = _mm_unpackhi_epi32(u[i], u[i + 4]);
+    }
+
+    for (unsigned i = 0; i < 8; i++) {
+        b[2 * i + 0] = _mm_unpacklo_epi8(w[i], zero);
+        b[2 * i + 1] = _mm_unpackhi_epi8(w[i], zero);
+    }
+
+#define STORE(field, value)                                                     \
+    _mm_storeu_si128((__m128i *) &table->field[index], (value))
+
+    STORE(pixel_clock,  _mm_or_si128(b[0x00], _mm_slli_epi16(b[0x01], 8)));
+    STORE(hactive,      _mm_or_si128(b[0x02], _mm_slli_epi16(_mm_and_si128(b[0x04], hi_nibble), 4)));
+    STORE(hblank,       _mm_or_si128(b[0x03], _mm_slli_epi16(_mm_and_si128(b[0x04], lo_nibble), 8)));
+    STORE(vactive,      _mm_or_si128(b[0x05], _mm_slli_epi16(_mm_and_si128(b[0x07], hi_nibble), 4)));
+    STORE(vblank,       _mm_or_si128(b[0x06], _mm_slli_epi16(_mm_and_si128(b[0x07], lo_nibble), 8)));
+    STORE(hsync_offset, _mm_or_si128(b[0x08], _mm_slli_epi16(_mm_and_si128(b[0x0b], _mm_set1_epi16(0xc0)), 2)));
+    STORE(hsync_width,  _mm_or_si128(b[0x09], _mm_slli_epi16(_mm_and_si128(b[0x0b], _mm_set1_epi16(0x30)), 4)));
+    STORE(vsync_offset, _mm_or_si128(_mm_srli_epi16(b[0x0a], 4),
+                                     _mm_slli_epi16(_mm_and_si128(b[0x0b], _mm_set1_epi16(0x0c)), 2)));
+    STORE(vsync_width,  _mm_or_si128(_mm_and_si128(b[0x0a], lo_nibble),
+                                     _mm_slli_epi16(_mm_and_si128(b[0x0b], _mm_set1_epi16(0x03)), 4)));
+    STORE(hsize,        _mm_or_si128(b[0x0c], _mm_slli_epi16(_mm_and_si128(b[0x0e], hi_nibble), 4)));
+    STORE(vsize,        _mm_or_si128(b[0x0d], _mm_slli_epi16(_mm_and_si128(b[0x0e], lo_nibble), 8)));
+
+#undef STORE
+
+    for (unsigned i = 0; i < 8; i++)
+        table->flags[index + i] = dtds[i][0x11];
+}
+#endif
+
+void
+edid_dtd_table_unpack(struct edid_dtd_table * const table,
+                      const uint8_t * const * const dtds, size_t count,
+                      const uint8_t block)
+{
+    const size_t index = table->count;
+    size_t i = 0;
+
+    if (count > EDID_DTD_TABLE_MAX - index) {
+        table->dropped = table->dropped + count - (EDID_DTD_TABLE_MAX - index);
+        count = EDID_DTD_TABLE_MAX - index;
+    }
+
+#if defined(__SSE2__)
+    for (; i + 8 <= count; i = i + 8)
+        _unpack8(table, index + i, dtds + i);
+#endif
+    for (; i < count; i++)
+        _unpack1(table, index + i, dtds[i]);
+
+    memset(&table->block[index], block, count);
+    table->count = index + count;
+}
+
+struct _dtd_collection {
+    const uint8_t *dtd[EDID_DTD_TABLE_MAX];
+    uint8_t        block[EDID_DTD_TABLE_MAX];
+    size_t         count;
+    size_t         dropped;
+};
+
+static void
+_collect(void * const context, const uint8_t block,
+         const struct edid_detailed_timing_descriptor * const dtd)
+{
+    struct _dtd_collection * const collection = context;
+
+    if (!edid_detailed_timing_get_pixel_clock((const uint8_t *) dtd))
+        return;
+
+    if (collection->count == EDID_DTD_TABLE_MAX) {
+        collection->dropped++;
+        return;
+    }
+
+    collection->dtd[collection->count] = (const uint8_t *) dtd;
+    collection->block[collection->count] = block;
+    collection->count++;
+}
+
+static const struct edid_visitor _dtd_visitor = {
+    .detailed_timing = _collect,
+};
+
+size_t
+edid_dtd_table_decode(struct edid_dtd_table * const table,
+                      const uint8_t * const data, const size_t length)
+{
+    struct _dtd_collection collection = { .count = 0 };
+
+    table->count = 0;
+    table->dropped = 0;
+
+    if (!edid_visit(data, length, &_dtd_visitor, &collection, NULL))
+        return 0;
+
+    edid_dtd_table_unpack(table, collection.dtd, collection.count, 0);
+    memcpy(table->block, collection.block, collection.count);
+    table->dropped = collection.dropped;
+
+    return table->count;
+}
+
+static inline uint32_t
+_refresh1(const struct edid_dtd_table * const table, const size_t i)
+{
+    const uint32_t htotal = table->hactive[i] + table->hblank[i];
+    const uint32_t vtotal = table->vactive[i] + table->vblank[i];
+    const double pixels = (double) htotal * vtotal;
+
+    return pixels ? table->pixel_clock[i] * 1e7 / pixels : 0;
+}
+
+#if defined(__SSE2__)
+/*
+ * The pixel clock and the totals of the eight timings from index, widened to
+ * 32 bits: lanes 0-3 in [0] and 4-7 in [1].  The totals cannot overflow 16
+ * bits as each term is at most 12 bits wide.
+ */
+static inline void
+_load8(const struct edid_dtd_table * const table, const size_t index,
+       __m128i clock[2], __m128i htotal[2], __m128i vtotal[2])
+{
+    const __m128i zero = _mm_setzero_si128();
+
+#define LOAD(field)                                                             \
+    _mm_loadu_si128((const __m128i *) &table->field[index])
+
+    const __m128i c = LOAD(pixel_clock);
+    const __m128i h = _mm_add_epi16(LOAD(hactive), LOAD(hblank));
+    const __m128i v = _mm_add_epi16(LOAD(vactive), LOAD(vblank));
+
+#undef LOAD
+
+    clock[0] = _mm_unpacklo_epi16(c, zero);
+    clock[1] = _mm_unpackhi_epi16(c, zero);
+    htotal[0] = _mm_unpacklo_epi16(h, zero);
+    htotal[1] = _mm_unpackhi_epi16(h, zero);
+    vtotal[0] = _mm_unpacklo_epi16(v, zero);
+    vtotal[1] = _mm_unpackhi_epi16(v, zero);
+}
+
+/* lanes 2 * pair and 2 * pair + 1 of \p values as doubles */
+static inline __m128d
+_pair(const __m128i values[2], const unsigned pair)
+{
+    const __m128i quad = values[pair >> 1];
+
+    return _mm_cvtepi32_pd(pair & 1 ? _mm_srli_si128(quad, 8) : quad);
+}
+
+/*
+ * As _refresh1 for eight timings.  Every lane performs the same double
+ * operations as the scalar path, so the results are identical.
+ */
+static void
+_refresh8(const struct edid_dtd_table * const table, const size_t index,
+          uint32_t * const refresh)
+{
+    const __m128d zero = _mm_setzero_pd();
+    __m128i clock[2], htotal[2], vtotal[2];
+
+    _load8(table, index, clock, htotal, vtotal);
+
+    for (unsigned pair = 0; pair < 4; pair++) {
+        const __m128d pixels = _mm_mul_pd(_pair(htotal, pair), _pair(vtotal, pair));
+        const __m128d rate = _mm_div_pd(_mm_mul_pd(_pair(clock, pair), _mm_set1_pd(1e7)),
+                                        pixels);
+        const __m128d value = _mm_and_pd(rate, _mm_cmpneq_pd(pixels, zero));
+
+        refresh[index + 2 * pair + 0] = _mm_cvtsd_f64(value);
+        refresh[index + 2 * pair + 1] = _mm_cvtsd_f64(_mm_unpackhi_pd(value, value));
+    }
+}
+#endif
+
+void
+edid_dtd_table_refresh(const struct edid_dtd_table * const table,
+                       uint32_t * const refresh)
+{
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 8 <= table->count; i = i + 8)
+        _refresh8(table, i, refresh);
+#endif
+    for (; i < table->count; i++)
+        refresh[i] = _refresh1(table, i);
+}
+
+bool
+edid_dtd_limits_decode(struct edid_dtd_limits * const limits,
+                       const uint8_t * const data, const size_t length)
+{
+    if (length < EDID_BLOCK_SIZE)
+        return false;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        const uint8_t * const descriptor = data + 0x36 + i * EDID_DESCRIPTOR_SIZE;
+        const uint8_t * const range = descriptor + 5;
+
+        if (edid_monitor_descriptor_get_flag0(descriptor) ||
+            edid_monitor_descriptor_get_flag1(descriptor) ||
+            edid_monitor_descriptor_get_tag(descriptor) != EDID_MONITOR_DESCRIPTOR_MONITOR_RANGE_LIMITS)
+            continue;
+
+        uint32_t min_vrate = edid_monitor_range_limits_get_minimum_vertical_rate(range);
+        uint32_t max_vrate = edid_monitor_range_limits_get_maximum_vertical_rate(range);
+        uint32_t min_hrate = edid_monitor_range_limits_get_minimum_horizontal_rate(range);
+        uint32_t max_hrate = edid_monitor_range_limits_get_maximum_horizontal_rate(range);
+
+        /* 1.4 extends the rates beyond 255 Hz/kHz */
+        if (edid_get_version(data) == 1 && edid_get_revision(data) >= 4) {
+            const uint8_t voffsets = edid_monitor_descriptor_get_vertical_rate_offsets(descriptor);
+            const uint8_t hoffsets = edid_monitor_descriptor_get_horizontal_rate_offsets(descriptor);
+
+            if (voffsets == EDID_RANGE_LIMITS_RATE_OFFSETS_MINIMUM_AND_MAXIMUM)
+                min_vrate = min_vrate + 255;
+            if (voffsets & EDID_RANGE_LIMITS_RATE_OFFSETS_MAXIMUM)
+                max_vrate = max_vrate + 255;
+            if (hoffsets == EDID_RANGE_LIMITS_RATE_OFFSETS_MINIMUM_AND_MAXIMUM)
+                min_hrate = min_hrate + 255;
+            if (hoffsets & EDID_RANGE_LIMITS_RATE_OFFSETS_MAXIMUM)
+                max_hrate = max_hrate + 255;
+        }
+
+        limits->min_vfreq = min_vrate * 1000;
+        limits->max_vfreq = max_vrate * 1000;
+        limits->min_hfreq = min_hrate * 1000;
+        limits->max_hfreq = max_hrate * 1000;
+        limits->max_pixel_clock = edid_monitor_range_limits_get_maximum_supported_pixel_clock(range) * 10000;
+
+        return true;
+    }
+
+    return false;
+}
+
+static inline bool
+_check1(const struct edid_dtd_table * const table, const size_t i,
+        const struct edid_dtd_limits * const limits)
+{
+    const uint32_t htotal = table->hactive[i] + table->hblank[i];
+    const uint32_t vtotal = table->vactive[i] + table->vblank[i];
+    const double clock = table->pixel_clock[i] * 1e4;       /* Hz */
+    const double hfreq = htotal ? clock / htotal : 0;       /* Hz */
+    const double vfreq = vtotal ? hfreq * 1e3 / vtotal : 0; /* mHz */
+
+    return clock <= limits->max_pixel_clock * 1e3 &&
+           hfreq >= limits->min_hfreq && hfreq <= limits->max_hfreq &&
+           vfreq >= limits->min_vfreq && vfreq <= limits->max_vfreq;
+}
+
+#if defined(__SSE2__)
+/*
+ * As _check1 for eight timings, as bits 0-7.  A zero total yields 0 rather
+ * than the quotient, as in the scalar path, and the results are identical.
+ */
+static unsigned
+_check8(const struct edid_dtd_table * const table, const size_t index,
+        const struct edid_dtd_limits * const limits)
+{
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d max_clock = _mm_set1_pd(limits->max_pixel_clock * 1e3);
+    const __m128d min_hfreq = _mm_set1_pd(limits->min_hfreq);
+    const __m128d max_hfreq = _mm_set1_pd(limits->max_hfreq);
+    const __m128d min_vfreq = _mm_set1_pd(limits->min_vfreq);
+    const __m128d max_vfreq = _mm_set1_pd(limits->max_vfreq);
+    __m128i clocks[2], htotals[2], vtotals[2];
+    unsigned mask = 0;
+
+    _load8(table, index, clocks, htotals, vtotals);
+
+    for (unsigned pair = 0; pair < 4; pair++) {
+        const __m128d htotal = _pair(htotals, pair);
+        const __m128d vtotal = _pair(vtotals, pair);
+        const __m128d clock = _mm_mul_pd(_pair(clocks, pair), _mm_set1_pd(1e4));
+        const __m128d hfreq = _mm_and_pd(_mm_div_pd(clock, htotal),
+                                         _mm_cmpneq_pd(htotal, zero));
+        const __m128d vfreq = _mm_and_pd(_mm_div_pd(_mm_mul_pd(hfreq, _mm_set1_pd(1e3)), vtotal),
+                                         _mm_cmpneq_pd(vtotal, zero));
+        __m128d within = _mm_cmple_pd(clock, max_clock);
+
+        within = _mm_and_pd(within, _mm_cmpge_pd(hfreq, min_hfreq));
+        within = _mm_and_pd(within, _mm_cmple_pd(hfreq, max_hfreq));
+        within = _mm_and_pd(within, _mm_cmpge_pd(vfreq, min_vfreq));
+        within = _mm_and_pd(within, _mm_cmple_pd(vfreq, max_vfreq));
+
+        mask = mask | (unsigned) _mm_movemask_pd(within) << (2 * pair);
+    }
+
+    return mask;
+}
+#endif
+
+uint64_t
+edid_dtd_table_check(const struct edid_dtd_table * const table,
+                     const struct edid_dtd_limits * const limits)
+{
+    uint64_t mask = 0;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 8 <= table->count; i = i + 8)
+        mask = mask | ((uint64_t) _check8(table, i, limits) << i);
+#endif
+    for (; i < table->count; i++)
+        mask = mask | ((uint64_t) _check1(table, i, limits) << i);
+
+    return mask;
+}
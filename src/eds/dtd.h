@@ -0,0 +1,107 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_dtd_h
+#define eds_dtd_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define EDID_DTD_TABLE_MAX                      (0x40)
+
+/*!
+ * Detailed timings in struct-of-arrays form so that checks over every timing
+ * of a display run as straight loops over each field.  Values are as encoded
+ * in the descriptor: the pixel clock is in units of 10 kHz, the image size in
+ * mm.  block is the index of the block the timing was found in.
+ */
+struct edid_dtd_table {
+    size_t   count;
+    size_t   dropped;
+
+    uint16_t pixel_clock[EDID_DTD_TABLE_MAX];
+    uint16_t hactive[EDID_DTD_TABLE_MAX];
+    uint16_t hblank[EDID_DTD_TABLE_MAX];
+    uint16_t vactive[EDID_DTD_TABLE_MAX];
+    uint16_t vblank[EDID_DTD_TABLE_MAX];
+    uint16_t hsync_offset[EDID_DTD_TABLE_MAX];
+    uint16_t hsync_width[EDID_DTD_TABLE_MAX];
+    uint16_t vsync_offset[EDID_DTD_TABLE_MAX];
+    uint16_t vsync_width[EDID_DTD_TABLE_MAX];
+    uint16_t hsize[EDID_DTD_TABLE_MAX];
+    uint16_t vsize[EDID_DTD_TABLE_MAX];
+    uint8_t  flags[EDID_DTD_TABLE_MAX];
+    uint8_t  block[EDID_DTD_TABLE_MAX];
+};
+
+/*! limits of a monitor range limits descriptor */
+struct edid_dtd_limits {
+    uint32_t max_pixel_clock;                   /* kHz */
+    uint32_t min_hfreq;                         /* Hz */
+    uint32_t max_hfreq;                         /* Hz */
+    uint32_t min_vfreq;                         /* mHz */
+    uint32_t max_vfreq;                         /* mHz */
+};
+
+/*!
+ * Collect the detailed timings of the base block and of every CEA-861
+ * extension present in \p length and unpack them into \p table.  Timings
+ * beyond EDID_DTD_TABLE_MAX are counted in dropped.  Returns the number of
+ * timings in the table.
+ */
+size_t
+edid_dtd_table_decode(struct edid_dtd_table *table, const uint8_t *data,
+                      size_t length);
+
+/*! append the \p count 18 byte descriptors in \p dtds from \p block */
+void
+edid_dtd_table_unpack(struct edid_dtd_table *table,
+                      const uint8_t * const *dtds, size_t count, uint8_t block);
+
+/*! refresh rate of every timing, in mHz */
+void
+edid_dtd_table_refresh(const struct edid_dtd_table *table, uint32_t *refresh);
+
+/*!
+ * Fill \p limits from the monitor range limits descriptor of the base block.
+ * Returns false if there is none.
+ */
+bool
+edid_dtd_limits_decode(struct edid_dtd_limits *limits, const uint8_t *data,
+                       size_t length);
+
+/*! mask of the timings (bit i for entry i) which are within \p limits */
+uint64_t
+edid_dtd_table_check(const struct edid_dtd_table *table,
+                     const struct edid_dtd_limits *limits);
+
+#endif
+
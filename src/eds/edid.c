@@ -0,0 +1,108 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "ddc.h"
+#include "edid.h"
+#include "cea861.h"
+
+static void
+edid_visit_base(const struct edid * const edid,
+                const struct edid_visitor * const visitor, void * const context)
+{
+    if (visitor->standard_timing) {
+        for (uint8_t i = 0; i < ARRAY_SIZE(edid->standard_timing_id); i++) {
+            const struct edid_standard_timing_descriptor * const desc =
+                &edid->standard_timing_id[i];
+
+            if (!memcmp(desc, EDID_STANDARD_TIMING_DESCRIPTOR_INVALID, sizeof(*desc)))
+                continue;
+
+            visitor->standard_timing(context, 0, desc);
+        }
+    }
+
+    if (!visitor->detailed_timing && !visitor->monitor_descriptor)
+        return;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(edid->detailed_timings); i++) {
+        if (edid_detailed_timing_is_monitor_descriptor(edid, i)) {
+            if (visitor->monitor_descriptor)
+                visitor->monitor_descriptor(context, 0,
+                                            &edid->detailed_timings[i].monitor);
+        } else {
+            if (visitor->detailed_timing)
+                visitor->detailed_timing(context, 0,
+                                         &edid->detailed_timings[i].timing);
+        }
+    }
+}
+
+bool
+edid_visit(const uint8_t * const data, const size_t length,
+           const struct edid_visitor * const visitor, void * const context,
+           const struct edid_block_mask * const blocks)
+{
+    const struct edid * const edid = (struct edid *) data;
+    size_t count;
+
+    if (length < EDID_BLOCK_SIZE || memcmp(data, EDID_HEADER, sizeof(EDID_HEADER)))
+        return false;
+
+    if (!blocks || edid_block_mask_test(blocks, 0))
+        edid_visit_base(edid, visitor, context);
+
+    count = length / EDID_BLOCK_SIZE;
+    if (count > (size_t) edid_get_extensions(data) + 1)
+        count = edid_get_extensions(data) + 1;
+
+    for (size_t i = 1; i < count; i++) {
+        const uint8_t * const block = data + i * EDID_BLOCK_SIZE;
+
+        if (blocks && !edid_block_mask_test(blocks, i))
+            continue;
+
+        switch (block[0]) {
+        case EDID_EXTENSION_CEA:
+            cea861_visit((const struct cea861_timing_block *) block, i,
+                         visitor, context);
+            break;
+        default:
+            if (visitor->unknown_extension)
+                visitor->unknown_extension(context, i,
+                                           (const struct edid_extension *) block);
+            break;
+        }
+    }
+
+    return true;
+}
+
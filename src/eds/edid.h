@@ -32,9 +32,13 @@
 #define eds_edid_h
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "access.h"
+#include "macros.h"
+
 #define EDID_I2C_DDC_DATA_ADDRESS               (0x50)
 
 #define EDID_BLOCK_SIZE                         (0x80)
@@ -102,6 +106,13 @@ enum edid_monitor_descriptor_type {
     EDID_MONITOR_DESCRIPTOR_MONITOR_SERIAL_NUMBER       = 0xff,
 };
 
+/* rates which are offset by 255 Hz/kHz in a 1.4 monitor range limits descriptor */
+enum edid_range_limits_rate_offsets {
+    EDID_RANGE_LIMITS_RATE_OFFSETS_NONE                 = 0x0,
+    EDID_RANGE_LIMITS_RATE_OFFSETS_MAXIMUM              = 0x2,
+    EDID_RANGE_LIMITS_RATE_OFFSETS_MINIMUM_AND_MAXIMUM  = 0x3,
+};
+
 enum edid_secondary_timing_support {
     EDID_SECONDARY_TIMING_NOT_SUPPORTED,
     EDID_SECONDARY_TIMING_GFT           = 0x02,
@@ -154,73 +165,73 @@ struct __attribute__ (( packed )) edid_detailed_timing_descriptor {
 static inline uint32_t
 edid_detailed_timing_pixel_clock(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return dtb->pixel_clock * 10000;
+    return edid_detailed_timing_get_pixel_clock((const uint8_t *) dtb) * 10000;
 }
 
 static inline uint16_t
 edid_detailed_timing_horizontal_blanking(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->horizontal_blanking_hi << 8) | dtb->horizontal_blanking_lo;
+    return edid_detailed_timing_get_horizontal_blanking((const uint8_t *) dtb);
 }
 
 static inline uint16_t
 edid_detailed_timing_horizontal_active(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->horizontal_active_hi << 8) | dtb->horizontal_active_lo;
+    return edid_detailed_timing_get_horizontal_active((const uint8_t *) dtb);
 }
 
 static inline uint16_t
 edid_detailed_timing_vertical_blanking(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->vertical_blanking_hi << 8) | dtb->vertical_blanking_lo;
+    return edid_detailed_timing_get_vertical_blanking((const uint8_t *) dtb);
 }
 
 static inline uint16_t
 edid_detailed_timing_vertical_active(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->vertical_active_hi << 8) | dtb->vertical_active_lo;
+    return edid_detailed_timing_get_vertical_active((const uint8_t *) dtb);
 }
 
 static inline uint8_t
 edid_detailed_timing_vertical_sync_offset(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->vertical_sync_offset_hi << 4) | dtb->vertical_sync_offset_lo;
+    return edid_detailed_timing_get_vertical_sync_offset((const uint8_t *) dtb);
 }
 
 static inline uint8_t
 edid_detailed_timing_vertical_sync_pulse_width(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->vertical_sync_pulse_width_hi << 4) | dtb->vertical_sync_pulse_width_lo;
+    return edid_detailed_timing_get_vertical_sync_pulse_width((const uint8_t *) dtb);
 }
 
 static inline uint8_t
 edid_detailed_timing_horizontal_sync_offset(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->horizontal_sync_offset_hi << 4) | dtb->horizontal_sync_offset_lo;
+    return edid_detailed_timing_get_horizontal_sync_offset((const uint8_t *) dtb);
 }
 
 static inline uint8_t
 edid_detailed_timing_horizontal_sync_pulse_width(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->horizontal_sync_pulse_width_hi << 4) | dtb->horizontal_sync_pulse_width_lo;
+    return edid_detailed_timing_get_horizontal_sync_pulse_width((const uint8_t *) dtb);
 }
 
 static inline uint16_t
 edid_detailed_timing_horizontal_image_size(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->horizontal_image_size_hi << 8) | dtb->horizontal_image_size_lo;
+    return edid_detailed_timing_get_horizontal_image_size((const uint8_t *) dtb);
 }
 
 static inline uint16_t
 edid_detailed_timing_vertical_image_size(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->vertical_image_size_hi << 8) | dtb->vertical_image_size_lo;
+    return edid_detailed_timing_get_vertical_image_size((const uint8_t *) dtb);
 }
 
 static inline uint8_t
 edid_detailed_timing_stereo_mode(const struct edid_detailed_timing_descriptor * const dtb)
 {
-    return (dtb->stereo_mode_hi << 2 | dtb->stereo_mode_lo);
+    return edid_detailed_timing_get_stereo_mode((const uint8_t *) dtb);
 }
 
 
@@ -260,18 +271,18 @@ struct __attribute__ (( packed )) edid_standard_timing_descriptor {
     unsigned image_aspect_ratio : 2;
 };
 
-const inline uint32_t
+static inline uint32_t
 edid_standard_timing_horizontal_active(const struct edid_standard_timing_descriptor * const desc)
 {
-    return ((desc->horizontal_active_pixels + 31) << 3);
+    return ((edid_standard_timing_get_horizontal_active_pixels((const uint8_t *) desc) + 31) << 3);
 }
 
-const inline uint32_t
+static inline uint32_t
 edid_standard_timing_vertical_active(const struct edid_standard_timing_descriptor * const desc)
 {
     const uint32_t hres = edid_standard_timing_horizontal_active(desc);
 
-    switch (desc->image_aspect_ratio) {
+    switch (edid_standard_timing_get_image_aspect_ratio((const uint8_t *) desc)) {
     case EDID_ASPECT_RATIO_16_10:
         return ((hres * 10) >> 4);
     case EDID_ASPECT_RATIO_4_3:
@@ -285,10 +296,10 @@ edid_standard_timing_vertical_active(const struct edid_standard_timing_descripto
     return hres;
 }
 
-const inline uint32_t
+static inline uint32_t
 edid_standard_timing_refresh_rate(const struct edid_standard_timing_descriptor * const desc)
 {
-    return (desc->refresh_rate + 60);
+    return (edid_standard_timing_get_refresh_rate((const uint8_t *) desc) + 60);
 }
 
 
@@ -400,20 +411,45 @@ struct __attribute__ (( packed )) edid {
     uint8_t  checksum;
 };
 
+/*! spell the PNP ID \p key (see edid_manufacturer_key) */
 static inline void
-edid_manufacturer(const struct edid * const edid, char manufacturer[4])
+edid_manufacturer_name(const uint16_t key, char manufacturer[4])
 {
-    manufacturer[0] = '@' + ((edid->manufacturer & 0x007c) >> 2);
-    manufacturer[1] = '@' + (((edid->manufacturer & 0x0003) >> 00) << 3)
-                          | (((edid->manufacturer & 0xe000) >> 13) << 0);
-    manufacturer[2] = '@' + ((edid->manufacturer & 0x1f00) >> 8);
+    manufacturer[0] = '@' + ((key >> 10) & 0x1f);
+    manufacturer[1] = '@' + ((key >>  5) & 0x1f);
+    manufacturer[2] = '@' + ((key >>  0) & 0x1f);
     manufacturer[3] = '\0';
 }
 
+static inline void
+edid_manufacturer(const struct edid * const edid, char manufacturer[4])
+{
+    edid_manufacturer_name(edid_get_manufacturer((const uint8_t *) edid),
+                           manufacturer);
+}
+
+/*! the 15-bit PNP ID as stored (big endian) in the base block */
+static inline uint16_t
+edid_manufacturer_key(const struct edid * const edid)
+{
+    return edid_get_manufacturer((const uint8_t *) edid) & 0x7fff;
+}
+
+/*! the PNP ID as three ASCII characters packed into the low 24 bits */
+static inline uint32_t
+edid_manufacturer_id(const struct edid * const edid)
+{
+    const uint32_t key = edid_manufacturer_key(edid);
+
+    return (('@' + ((key >> 10) & 0x1f)) << 16) |
+           (('@' + ((key >>  5) & 0x1f)) <<  8) |
+           (('@' + ((key >>  0) & 0x1f)) <<  0);
+}
+
 static inline double
 edid_gamma(const struct edid * const edid)
 {
-    return (edid->display_transfer_characteristics + 100) / 100.0;
+    return (edid_get_display_transfer_characteristics((const uint8_t *) edid) + 100) / 100.0;
 }
 
 static inline bool
@@ -439,22 +475,23 @@ struct __attribute__ (( packed )) edid_color_characteristics_data {
 static inline struct edid_color_characteristics_data
 edid_color_characteristics(const struct edid * const edid)
 {
+    const uint8_t * const data = (const uint8_t *) edid;
     const struct edid_color_characteristics_data characteristics = {
         .red = {
-            .x = (edid->red_x << 2) | edid->red_x_low,
-            .y = (edid->red_y << 2) | edid->red_y_low,
+            .x = edid_get_red_x(data),
+            .y = edid_get_red_y(data),
         },
         .green = {
-            .x = (edid->green_x << 2) | edid->green_x_low,
-            .y = (edid->green_y << 2) | edid->green_y_low,
+            .x = edid_get_green_x(data),
+            .y = edid_get_green_y(data),
         },
         .blue = {
-            .x = (edid->blue_x << 2) | edid->blue_x_low,
-            .y = (edid->blue_y << 2) | edid->blue_y_low,
+            .x = edid_get_blue_x(data),
+            .y = edid_get_blue_y(data),
         },
         .white = {
-            .x = (edid->white_x << 2) | edid->white_x_low,
-            .y = (edid->white_y << 2) | edid->white_y_low,
+            .x = edid_get_white_x(data),
+            .y = edid_get_white_y(data),
         },
     };
 
@@ -489,6 +526,33 @@ edid_verify_checksum(const uint8_t * const block)
     return (checksum == 0);
 }
 
+/*!
+ * Identify the display model rather than the unit: the base block is hashed
+ * (FNV-1a) with the serial numbers, the manufacture date and the checksum
+ * excluded.
+ */
+static inline uint64_t
+edid_model_fingerprint(const uint8_t * const block)
+{
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+    for (uint8_t i = 0; i < EDID_BLOCK_SIZE - 1; i++) {
+        const uint8_t descriptor = i < 0x36 ? 0 : 0x36 + (i - 0x36) / 0x12 * 0x12;
+
+        if (i >= 0x0c && i <= 0x11)
+            continue;
+
+        if (descriptor && i >= descriptor + 5 && i < 0x7e &&
+            !block[descriptor] && !block[descriptor + 1] &&
+            block[descriptor + 3] == EDID_MONITOR_DESCRIPTOR_MONITOR_SERIAL_NUMBER)
+            continue;
+
+        hash = (hash ^ block[i]) * UINT64_C(0x100000001b3);
+    }
+
+    return hash;
+}
+
 static inline double
 edid_decode_fixed_point(uint16_t value)
 {
@@ -502,5 +566,56 @@ edid_decode_fixed_point(uint16_t value)
     return result;
 }
 
+struct cea861_data_block_header;
+struct cea861_short_audio_descriptor;
+struct cea861_short_video_descriptor;
+struct cea861_speaker_allocation_data_block;
+struct cea861_vendor_specific_data_block;
+struct edid_block_mask;
+
+/*!
+ * Callbacks for edid_visit.  Each receives the caller's context, the index of
+ * the block being decoded and a pointer into the original buffer.  Callbacks
+ * which are left NULL are skipped, and a structure is only walked if one of
+ * the callbacks interested in it is set.
+ *
+ * data_block is invoked for every CEA-861 data block ahead of the descriptor
+ * callbacks for it; unknown_data_block only for those which are not decoded.
+ */
+struct edid_visitor {
+    void (*standard_timing)(void *context, uint8_t block,
+                            const struct edid_standard_timing_descriptor *std);
+    void (*detailed_timing)(void *context, uint8_t block,
+                            const struct edid_detailed_timing_descriptor *dtd);
+    void (*monitor_descriptor)(void *context, uint8_t block,
+                               const struct edid_monitor_descriptor *mon);
+    void (*unknown_extension)(void *context, uint8_t block,
+                              const struct edid_extension *ext);
+
+    void (*data_block)(void *context, uint8_t block,
+                       const struct cea861_data_block_header *header);
+    void (*short_video_descriptor)(void *context, uint8_t block,
+                                   const struct cea861_short_video_descriptor *svd);
+    void (*short_audio_descriptor)(void *context, uint8_t block,
+                                   const struct cea861_short_audio_descriptor *sad);
+    void (*speaker_allocation)(void *context, uint8_t block,
+                               const struct cea861_speaker_allocation_data_block *sadb);
+    void (*vendor_specific)(void *context, uint8_t block,
+                            const struct cea861_vendor_specific_data_block *vsdb);
+    void (*unknown_data_block)(void *context, uint8_t block,
+                               const struct cea861_data_block_header *header);
+};
+
+/*!
+ * Walk the EDID in data, invoking the visitor for each structure found.  If
+ * blocks is not NULL only the blocks set in the mask are decoded.  Returns
+ * false if the base block is missing or invalid; malformed extension blocks
+ * are decoded as far as they are well formed.
+ */
+bool
+edid_visit(const uint8_t *data, size_t length,
+           const struct edid_visitor *visitor, void *context,
+           const struct edid_block_mask *blocks);
+
 #endif
 
@@ -0,0 +1,536 @@
+/* vim: set et fde fdm=syntax ft=cpp.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_edid_hpp
+#define eds_edid_hpp
+
+#if __cplusplus < 202002L
+#error "eds/edid.hpp requires C++20"
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * constexpr counterpart of edid.h and cea861.h.  The field layout and the VIC
+ * table are generated from the same descriptions (fields.def and
+ * cea861-timings.def) as the C headers, but everything here can be evaluated
+ * at compile time so that an EDID baked into an image is validated and
+ * decoded by the compiler:
+ *
+ *  static constexpr std::array<std::uint8_t, 256> edid = { ... };
+ *  static constexpr eds::info info = eds::decode(edid);
+ *  static_assert(info, "malformed EDID");
+ */
+
+namespace eds {
+
+inline constexpr std::size_t block_size = 0x80;
+inline constexpr std::size_t max_modes = 0x40;
+
+inline constexpr std::array<std::uint8_t, 8> header = {
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+};
+
+inline constexpr std::array<std::uint8_t, 3> hdmi_oui = { 0x00, 0x0c, 0x03 };
+
+namespace detail {
+
+constexpr std::uint32_t
+load_le(const std::uint8_t *data, unsigned bytes)
+{
+    std::uint32_t value = 0;
+
+    for (unsigned i = bytes; i > 0; i--)
+        value = (value << 8) | data[i - 1];
+
+    return value;
+}
+
+constexpr std::uint32_t
+load_be(const std::uint8_t *data, unsigned bytes)
+{
+    std::uint32_t value = 0;
+
+    for (unsigned i = 0; i < bytes; i++)
+        value = (value << 8) | data[i];
+
+    return value;
+}
+
+constexpr std::uint32_t
+bits(std::uint32_t value, unsigned shift, unsigned width)
+{
+    return (value >> shift) & ((std::uint32_t{1} << width) - 1);
+}
+
+}
+
+#define EDS_FIELD(structure, field, type, offset, shift, width)                  \
+    constexpr type                                                              \
+    structure##_get_##field(const std::uint8_t *data)                           \
+    {                                                                           \
+        return static_cast<type>(detail::bits(data[offset], shift, width));    \
+    }
+
+#define EDS_FIELD_SPLIT(structure, field, type, lo_offset, lo_shift, lo_width,  \
+                        hi_offset, hi_shift, hi_width)                          \
+    constexpr type                                                              \
+    structure##_get_##field(const std::uint8_t *data)                           \
+    {                                                                           \
+        return static_cast<type>(                                               \
+            (detail::bits(data[hi_offset], hi_shift, hi_width) << (lo_width)) | \
+            detail::bits(data[lo_offset], lo_shift, lo_width));                 \
+    }
+
+#define EDS_FIELD_LE(structure, field, type, offset, bytes)                     \
+    constexpr type                                                              \
+    structure##_get_##field(const std::uint8_t *data)                           \
+    {                                                                           \
+        return static_cast<type>(detail::load_le(data + (offset), bytes));      \
+    }
+
+#define EDS_FIELD_BE(structure, field, type, offset, bytes)                     \
+    constexpr type                                                              \
+    structure##_get_##field(const std::uint8_t *data)                           \
+    {                                                                           \
+        return static_cast<type>(detail::load_be(data + (offset), bytes));      \
+    }
+
+#include "fields.def"
+
+#undef EDS_FIELD_BE
+#undef EDS_FIELD_LE
+#undef EDS_FIELD_SPLIT
+#undef EDS_FIELD
+
+struct cea861_timing {
+    std::uint16_t hactive;
+    std::uint16_t vactive;
+    bool          interlaced;
+    std::uint16_t htotal;
+    std::uint16_t hblank;
+    std::uint16_t vtotal;
+    double        vblank;
+    double        hfreq;                        /* kHz */
+    double        vfreq;                        /* Hz */
+    double        pixclk;                       /* MHz */
+};
+
+namespace detail {
+
+enum { INTERLACED, PROGRESSIVE };
+
+inline constexpr std::size_t cea861_vics = [] {
+    std::size_t count = 0;
+
+    for (std::size_t vic : {
+#define CEA861_TIMING(vic, ...) vic,
+#include "cea861-timings.def"
+#undef CEA861_TIMING
+         })
+        count = vic >= count ? vic + 1 : count;
+
+    return count;
+}();
+
+inline constexpr auto cea861_timings = [] {
+    std::array<cea861_timing, cea861_vics> table{};
+
+#define CEA861_TIMING(vic, hactive, vactive, mode, htotal, hblank, vtotal,      \
+                      vblank, hfreq, vfreq, pixclk)                             \
+    table[vic] = { hactive, vactive, mode == INTERLACED, htotal, hblank,        \
+                   vtotal, vblank, hfreq, vfreq, pixclk };
+#include "cea861-timings.def"
+#undef CEA861_TIMING
+
+    return table;
+}();
+
+}
+
+/*! the timing for a CEA-861 VIC, or nullptr if it is unknown */
+constexpr const cea861_timing *
+vic_lookup(std::uint8_t vic)
+{
+    if (vic >= detail::cea861_timings.size() || !detail::cea861_timings[vic].hactive)
+        return nullptr;
+    return &detail::cea861_timings[vic];
+}
+
+/*!
+ * the VIC of a short video descriptor: codes 129-192 carry the native flag,
+ * every other code is the VIC itself, and the reserved codes yield 0
+ */
+constexpr std::uint8_t
+cea861_short_video_descriptor_vic(const std::uint8_t *svd)
+{
+    if (svd[0] == 0x00 || svd[0] == 0x80 || svd[0] >= 0xfe)
+        return 0;
+    return svd[0] > 0x80 && svd[0] <= 0xc0 ? svd[0] & 0x7f : svd[0];
+}
+
+constexpr bool
+cea861_short_video_descriptor_native(const std::uint8_t *svd)
+{
+    return svd[0] > 0x80 && svd[0] <= 0xc0;
+}
+
+constexpr bool
+verify_checksum(const std::uint8_t *block)
+{
+    std::uint8_t checksum = 0;
+
+    for (std::size_t i = 0; i < block_size; i++)
+        checksum = static_cast<std::uint8_t>(checksum + block[i]);
+
+    return checksum == 0;
+}
+
+enum class error {
+    none,
+    truncated,
+    header,
+    checksum,
+    dtd_offset,
+    data_block_overrun,
+};
+
+enum class mode_source {
+    detailed_timing,
+    standard_timing,
+    cea861_vic,
+};
+
+struct mode {
+    std::uint16_t hactive = 0;
+    std::uint16_t vactive = 0;
+    std::uint32_t pixel_clock = 0;              /* kHz */
+    std::uint32_t refresh = 0;                  /* mHz */
+    mode_source   source = mode_source::detailed_timing;
+    std::uint8_t  vic = 0;
+    bool          interlaced = false;
+    bool          preferred = false;
+    bool          native = false;
+};
+
+/*! mirrors struct edid_info; status and block identify the first failure */
+struct info {
+    error                       status = error::none;
+    std::uint8_t                block = 0;
+
+    std::array<char, 4>         manufacturer{};
+    std::uint16_t               product = 0;
+    std::uint32_t               serial_number = 0;
+    std::array<char, 14>        name{};
+
+    std::uint8_t                version = 0;
+    std::uint8_t                revision = 0;
+    std::uint8_t                extensions = 0;
+    bool                        digital = false;
+    std::uint16_t               width = 0;      /* mm */
+    std::uint16_t               height = 0;     /* mm */
+
+    bool                        basic_audio = false;
+    bool                        hdmi = false;
+    std::uint16_t               physical_address = 0;
+    std::uint16_t               max_tmds_clock = 0;     /* MHz */
+
+    std::size_t                 modes = 0;
+    std::array<eds::mode, max_modes> mode{};
+
+    constexpr explicit operator bool() const
+    {
+        return status == error::none;
+    }
+};
+
+namespace detail {
+
+constexpr void
+add_mode(info &info, const struct mode &mode)
+{
+    if (info.modes < info.mode.size())
+        info.mode[info.modes++] = mode;
+}
+
+constexpr void
+add_detailed_timing(info &info, const std::uint8_t *dtd, bool preferred)
+{
+    struct mode mode;
+    std::uint64_t htotal, vtotal;
+
+    if (!edid_detailed_timing_get_pixel_clock(dtd))
+        return;
+
+    mode.source = mode_source::detailed_timing;
+    mode.hactive = edid_detailed_timing_get_horizontal_active(dtd);
+    mode.vactive = edid_detailed_timing_get_vertical_active(dtd);
+    mode.pixel_clock = edid_detailed_timing_get_pixel_clock(dtd) * 10;
+    mode.interlaced = edid_detailed_timing_get_interlaced(dtd);
+    mode.preferred = preferred;
+
+    htotal = mode.hactive + edid_detailed_timing_get_horizontal_blanking(dtd);
+    vtotal = mode.vactive + edid_detailed_timing_get_vertical_blanking(dtd);
+    if (htotal && vtotal)
+        mode.refresh = static_cast<std::uint32_t>(
+            std::uint64_t{edid_detailed_timing_get_pixel_clock(dtd)} * 10000 * 1000
+                / (htotal * vtotal));
+
+    add_mode(info, mode);
+}
+
+constexpr std::uint16_t
+standard_timing_hactive(const std::uint8_t *desc)
+{
+    return static_cast<std::uint16_t>(
+        (edid_standard_timing_get_horizontal_active_pixels(desc) + 31) << 3);
+}
+
+constexpr std::uint16_t
+standard_timing_vactive(const std::uint8_t *desc)
+{
+    const std::uint32_t hres = standard_timing_hactive(desc);
+
+    switch (edid_standard_timing_get_image_aspect_ratio(desc)) {
+    case 0: return static_cast<std::uint16_t>((hres * 10) >> 4);
+    case 1: return static_cast<std::uint16_t>((hres * 3) >> 2);
+    case 2: return static_cast<std::uint16_t>((hres << 2) / 5);
+    default: return static_cast<std::uint16_t>((hres * 9) >> 4);
+    }
+}
+
+constexpr void
+add_standard_timing(info &info, const std::uint8_t *desc)
+{
+    struct mode mode;
+
+    if (desc[0] == 0x01 && desc[1] == 0x01)
+        return;
+
+    mode.source = mode_source::standard_timing;
+    mode.hactive = standard_timing_hactive(desc);
+    mode.vactive = standard_timing_vactive(desc);
+    mode.refresh = (edid_standard_timing_get_refresh_rate(desc) + 60) * 1000;
+
+    add_mode(info, mode);
+}
+
+constexpr void
+add_vic(info &info, const std::uint8_t *svd)
+{
+    const std::uint8_t vic = cea861_short_video_descriptor_vic(svd);
+    const cea861_timing *timing = vic_lookup(vic);
+    struct mode mode;
+
+    if (!timing)
+        return;
+
+    mode.source = mode_source::cea861_vic;
+    mode.vic = vic;
+    mode.hactive = timing->hactive;
+    mode.vactive = timing->vactive;
+    mode.pixel_clock = static_cast<std::uint32_t>(timing->pixclk * 1000);
+    mode.refresh = static_cast<std::uint32_t>(timing->vfreq * 1000);
+    mode.interlaced = timing->interlaced;
+    mode.native = cea861_short_video_descriptor_native(svd);
+
+    add_mode(info, mode);
+}
+
+constexpr void
+decode_base(info &info, const std::uint8_t *data)
+{
+    const std::uint16_t manufacturer = edid_get_manufacturer(data);
+
+    info.manufacturer[0] = static_cast<char>('@' + ((manufacturer >> 10) & 0x1f));
+    info.manufacturer[1] = static_cast<char>('@' + ((manufacturer >>  5) & 0x1f));
+    info.manufacturer[2] = static_cast<char>('@' + ((manufacturer >>  0) & 0x1f));
+    info.product = edid_get_product(data);
+    info.serial_number = edid_get_serial_number(data);
+
+    info.version = edid_get_version(data);
+    info.revision = edid_get_revision(data);
+    info.extensions = edid_get_extensions(data);
+    info.digital = edid_get_digital(data);
+    info.width = edid_get_maximum_horizontal_image_size(data) * 10;
+    info.height = edid_get_maximum_vertical_image_size(data) * 10;
+
+    for (std::size_t i = 0; i < 4; i++) {
+        const std::uint8_t *descriptor = data + 0x36 + i * 0x12;
+
+        if (edid_monitor_descriptor_get_flag0(descriptor) ||
+            edid_monitor_descriptor_get_flag1(descriptor) ||
+            edid_monitor_descriptor_get_flag2(descriptor)) {
+            /* the first DTD is always the preferred timing as of 1.4 */
+            add_detailed_timing(info, descriptor,
+                                i == 0 && (edid_get_preferred_timing_mode(data) ||
+                                           info.revision >= 4));
+            continue;
+        }
+
+        if (edid_monitor_descriptor_get_tag(descriptor) == 0xfc) {
+            for (std::size_t j = 0; j < 13 && descriptor[5 + j] != '\n'; j++)
+                info.name[j] = static_cast<char>(descriptor[5 + j]);
+        }
+    }
+
+    for (std::size_t i = 0; i < 8; i++)
+        add_standard_timing(info, data + 0x26 + i * 2);
+}
+
+constexpr bool
+decode_cea861(info &info, const std::uint8_t *block)
+{
+    const std::uint8_t offset = 4;
+    const std::uint8_t revision = cea861_timing_block_get_revision(block);
+    const std::uint8_t dtd_offset = cea861_timing_block_get_dtd_offset(block);
+
+    if (revision >= 2)
+        info.basic_audio = info.basic_audio ||
+                           cea861_timing_block_get_basic_audio_supported(block);
+
+    if (dtd_offset == 0)
+        return true;
+    if (dtd_offset < offset || dtd_offset >= block_size - 1) {
+        info.status = error::dtd_offset;
+        return false;
+    }
+
+    if (revision >= 3) {
+        for (std::size_t index = offset; index < dtd_offset; ) {
+            const std::uint8_t *db = block + index;
+            const std::uint8_t length = cea861_data_block_get_length(db);
+
+            if (index + 1 + length > dtd_offset) {
+                info.status = error::data_block_overrun;
+                return false;
+            }
+
+            switch (cea861_data_block_get_tag(db)) {
+            case 2:                             /* video */
+                for (std::uint8_t i = 0; i < length; i++)
+                    add_vic(info, db + 1 + i);
+                break;
+            case 3:                             /* vendor specific */
+                if (length >= 5 && db[1] == hdmi_oui[2] &&
+                    db[2] == hdmi_oui[1] && db[3] == hdmi_oui[0]) {
+                    info.hdmi = true;
+                    info.physical_address =
+                        hdmi_vendor_specific_data_block_get_physical_address(db);
+                    if (length >= 7)
+                        info.max_tmds_clock =
+                            hdmi_vendor_specific_data_block_get_max_tmds_clock(db) * 5;
+                }
+                break;
+            default:
+                break;
+            }
+
+            index = index + 1 + length;
+        }
+    }
+
+    for (std::size_t index = dtd_offset;
+         index + 18 <= block_size - 1 &&
+         edid_detailed_timing_get_pixel_clock(block + index);
+         index = index + 18)
+        add_detailed_timing(info, block + index, false);
+
+    return true;
+}
+
+}
+
+/*!
+ * Validate and decode an EDID.  Unlike edid_info_decode the input is held to
+ * the letter: every block must be present with a valid checksum and the
+ * CEA-861 data block collection must be well formed.  Display quirks are not
+ * applied.
+ */
+constexpr info
+decode(const std::uint8_t *data, std::size_t length)
+{
+    info info;
+
+    if (length < block_size) {
+        info.status = error::truncated;
+        return info;
+    }
+
+    for (std::size_t i = 0; i < header.size(); i++) {
+        if (data[i] != header[i]) {
+            info.status = error::header;
+            return info;
+        }
+    }
+
+    if (length < (edid_get_extensions(data) + std::size_t{1}) * block_size) {
+        info.status = error::truncated;
+        return info;
+    }
+
+    for (std::size_t i = 0; i <= edid_get_extensions(data); i++) {
+        if (!verify_checksum(data + i * block_size)) {
+            info.status = error::checksum;
+            info.block = static_cast<std::uint8_t>(i);
+            return info;
+        }
+    }
+
+    detail::decode_base(info, data);
+
+    for (std::size_t i = 1; i <= info.extensions; i++) {
+        const std::uint8_t *block = data + i * block_size;
+
+        if (block[0] != 0x02)                   /* CEA-861 */
+            continue;
+
+        if (!detail::decode_cea861(info, block)) {
+            info.block = static_cast<std::uint8_t>(i);
+            return info;
+        }
+    }
+
+    return info;
+}
+
+template <std::size_t N>
+constexpr info
+decode(const std::array<std::uint8_t, N> &edid)
+{
+    return decode(edid.data(), edid.size());
+}
+
+}
+
+#endif
+
@@ -0,0 +1,104 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+
+#include "edid.h"
+#include "extension.h"
+
+static const struct edid_extension_decoder edid_extension_default_decoder = {
+    .name   = NULL,
+    .decode = NULL,
+};
+
+/* indexed by tag; every slot is valid so dispatch never needs a bounds check */
+static const struct edid_extension_decoder *edid_extension_decoders[256];
+static const struct edid_extension_decoder *edid_extension_fallback =
+    &edid_extension_default_decoder;
+
+void
+edid_extension_register(const uint8_t tag,
+                        const struct edid_extension_decoder * const decoder)
+{
+    edid_extension_decoders[tag] = decoder;
+}
+
+void
+edid_extension_register_default(const struct edid_extension_decoder * const decoder)
+{
+    edid_extension_fallback = decoder ? decoder : &edid_extension_default_decoder;
+}
+
+const struct edid_extension_decoder *
+edid_extension_decoder(const uint8_t tag)
+{
+    return edid_extension_decoders[tag];
+}
+
+bool
+edid_extension_decode(void * const context, const uint8_t block,
+                      const struct edid_extension * const extension)
+{
+    const struct edid_extension_decoder * const decoder =
+        edid_extension_decoders[extension->tag];
+
+    if (!decoder) {
+        if (edid_extension_fallback->decode)
+            edid_extension_fallback->decode(context, block, extension);
+        return false;
+    }
+
+    if (decoder->decode)
+        decoder->decode(context, block, extension);
+
+    return true;
+}
+
+const char *
+edid_extension_name(const uint8_t tag)
+{
+    switch ((enum edid_extension_type) tag) {
+    case EDID_EXTENSION_TIMING:     return "timing";
+    case EDID_EXTENSION_CEA:        return "CEA-861";
+    case EDID_EXTENSION_VTB:        return "video timing block";
+    case EDID_EXTENSION_EDID_2_0:   return "EDID 2.0";
+    case EDID_EXTENSION_DI:         return "display information";
+    case EDID_EXTENSION_LS:         return "localised string";
+    case EDID_EXTENSION_MI:         return "microdisplay interface";
+    case EDID_EXTENSION_DTCDB_1:
+    case EDID_EXTENSION_DTCDB_2:
+    case EDID_EXTENSION_DTCDB_3:    return "display transfer characteristics";
+    case EDID_EXTENSION_BLOCK_MAP:  return "block map";
+    case EDID_EXTENSION_DDDB:       return "display device data block";
+    }
+
+    return NULL;
+}
+
@@ -0,0 +1,94 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_extension_h
+#define eds_extension_h
+
+#include <stdint.h>
+#include <stdbool.h>
+
+struct edid_extension;
+
+/*!
+ * A decoder for one extension block tag.  decode receives the caller's
+ * context, the index of the block within the EDID and the block itself.
+ */
+struct edid_extension_decoder {
+    const char *name;
+    void (*decode)(void *context, uint8_t block,
+                   const struct edid_extension *extension);
+};
+
+/*!
+ * Install \p decoder for extension blocks tagged \p tag, replacing any decoder
+ * already there; NULL removes it.  The decoder must outlive its registration.
+ * Registration is not synchronised with dispatch: register during start up,
+ * or at load time with EDID_EXTENSION_DECODER.
+ */
+void
+edid_extension_register(uint8_t tag,
+                        const struct edid_extension_decoder *decoder);
+
+/*!
+ * Install the decoder used for tags without one of their own; NULL restores
+ * the built in default, which does nothing.
+ */
+void
+edid_extension_register_default(const struct edid_extension_decoder *decoder);
+
+/*! the decoder registered for \p tag, or NULL if there is none */
+const struct edid_extension_decoder *
+edid_extension_decoder(uint8_t tag);
+
+/*!
+ * Pass \p extension to the decoder for its tag, or the default decoder.
+ * Returns true if a decoder for the tag itself was invoked.
+ */
+bool
+edid_extension_decode(void *context, uint8_t block,
+                      const struct edid_extension *extension);
+
+/*! the name of a tag of enum edid_extension_type, or NULL */
+const char *
+edid_extension_name(uint8_t tag);
+
+/*!
+ * Register \p decoder for \p tag when the object defining it is loaded, so
+ * that decoders can be linked in without touching the code which dispatches.
+ */
+#define EDID_EXTENSION_DECODER(tag, decoder)                                    \
+    static void __attribute__ (( constructor ))                                 \
+    edid_extension_register_##decoder(void)                                     \
+    {                                                                           \
+        edid_extension_register((tag), &(decoder));                             \
+    }
+
+#endif
+
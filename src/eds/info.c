@@ -0,0 +1,243 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "edid.h"
+#include "hdmi.h"
+#include "info.h"
+#include "quirks.h"
+#include "cea861.h"
+
+static void
+edid_info_add_detailed_timing(struct edid_info * const info,
+                              const struct edid_detailed_timing_descriptor * const dtd)
+{
+    struct edid_mode *mode;
+    uint64_t htotal, vtotal;
+
+    if (info->modes == ARRAY_SIZE(info->mode) ||
+        !edid_detailed_timing_get_pixel_clock((const uint8_t *) dtd))
+        return;
+
+    mode = &info->mode[info->modes++];
+    memset(mode, 0, sizeof(*mode));
+
+    mode->source = EDID_MODE_SOURCE_DETAILED_TIMING;
+    mode->hactive = edid_detailed_timing_horizontal_active(dtd);
+    mode->vactive = edid_detailed_timing_vertical_active(dtd);
+    mode->pixel_clock = edid_detailed_timing_pixel_clock(dtd) / 1000;
+    mode->interlaced = edid_detailed_timing_get_interlaced((const uint8_t *) dtd);
+
+    htotal = mode->hactive + edid_detailed_timing_horizontal_blanking(dtd);
+    vtotal = mode->vactive + edid_detailed_timing_vertical_blanking(dtd);
+    if (htotal && vtotal)
+        mode->refresh = (uint64_t) edid_detailed_timing_pixel_clock(dtd) * 1000
+                      / (htotal * vtotal);
+}
+
+static void
+edid_info_add_vic(struct edid_info * const info,
+                  const struct cea861_short_video_descriptor * const svd)
+{
+    const uint8_t vic = cea861_short_video_descriptor_vic(svd);
+    const struct cea861_timing *timing;
+    struct edid_mode *mode;
+
+    if (info->modes == ARRAY_SIZE(info->mode))
+        return;
+    if (vic >= ARRAY_SIZE(cea861_timings) || !cea861_timings[vic].hactive)
+        return;
+
+    timing = &cea861_timings[vic];
+    mode = &info->mode[info->modes++];
+    memset(mode, 0, sizeof(*mode));
+
+    mode->source = EDID_MODE_SOURCE_CEA861_VIC;
+    mode->vic = vic;
+    mode->hactive = timing->hactive;
+    mode->vactive = timing->vactive;
+    mode->pixel_clock = timing->pixclk * 1000;
+    mode->refresh = timing->vfreq * 1000;
+    mode->interlaced = timing->mode == INTERLACED;
+    mode->native = cea861_short_video_descriptor_native(svd);
+}
+
+static void
+edid_info_decode_base(struct edid_info * const info,
+                      const struct edid * const edid)
+{
+    const uint8_t * const data = (const uint8_t *) edid;
+
+    edid_manufacturer(edid, info->manufacturer);
+    info->product = edid_get_product(data);
+    info->serial_number = edid_get_serial_number(data);
+
+    info->version = edid_get_version(data);
+    info->revision = edid_get_revision(data);
+    info->extensions = edid_get_extensions(data);
+    info->digital = edid_get_digital(data);
+    info->width = edid_get_maximum_horizontal_image_size(data) * 10;
+    info->height = edid_get_maximum_vertical_image_size(data) * 10;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(edid->detailed_timings); i++) {
+        const struct edid_monitor_descriptor * const mon =
+            &edid->detailed_timings[i].monitor;
+
+        if (!edid_detailed_timing_is_monitor_descriptor(edid, i)) {
+            const uint8_t index = info->modes;
+
+            edid_info_add_detailed_timing(info, &edid->detailed_timings[i].timing);
+            /* the first DTD is always the preferred timing as of 1.4 */
+            if (i == 0 && index < info->modes)
+                info->mode[index].preferred = edid_get_preferred_timing_mode(data) ||
+                                              info->revision >= 4;
+            continue;
+        }
+
+        if (edid_monitor_descriptor_get_tag((const uint8_t *) mon) ==
+            EDID_MONITOR_DESCRIPTOR_MONITOR_NAME) {
+            memcpy(info->name, mon->data, sizeof(mon->data));
+            for (uint8_t j = 0; j < sizeof(mon->data); j++) {
+                if (info->name[j] == '\n') {
+                    info->name[j] = '\0';
+                    break;
+                }
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(edid->standard_timing_id); i++) {
+        const struct edid_standard_timing_descriptor * const desc =
+            &edid->standard_timing_id[i];
+        struct edid_mode *mode;
+
+        if (!memcmp(desc, EDID_STANDARD_TIMING_DESCRIPTOR_INVALID, sizeof(*desc)))
+            continue;
+        if (info->modes == ARRAY_SIZE(info->mode))
+            break;
+
+        mode = &info->mode[info->modes++];
+        memset(mode, 0, sizeof(*mode));
+
+        mode->source = EDID_MODE_SOURCE_STANDARD_TIMING;
+        mode->hactive = edid_standard_timing_horizontal_active(desc);
+        mode->vactive = edid_standard_timing_vertical_active(desc);
+        mode->refresh = edid_standard_timing_refresh_rate(desc) * 1000;
+    }
+}
+
+static void
+edid_info_visit_detailed_timing(void * const context, const uint8_t block,
+                                const struct edid_detailed_timing_descriptor * const dtd)
+{
+    (void) block;
+
+    edid_info_add_detailed_timing(context, dtd);
+}
+
+static void
+edid_info_visit_svd(void * const context, const uint8_t block,
+                    const struct cea861_short_video_descriptor * const svd)
+{
+    (void) block;
+
+    edid_info_add_vic(context, svd);
+}
+
+static void
+edid_info_visit_vsdb(void * const context, const uint8_t block,
+                     const struct cea861_vendor_specific_data_block * const vsdb)
+{
+    struct edid_info * const info = context;
+    const uint8_t length = cea861_data_block_get_length((const uint8_t *) vsdb);
+    const uint8_t * const oui = vsdb->ieee_registration;
+
+    (void) block;
+
+    if (length < 5 || oui[2] != HDMI_OUI[0] ||
+        oui[1] != HDMI_OUI[1] || oui[0] != HDMI_OUI[2])
+        return;
+
+    info->hdmi = true;
+    info->physical_address =
+        hdmi_vendor_specific_data_block_get_physical_address((const uint8_t *) vsdb);
+    if (length >= HDMI_VSDB_MAX_TMDS_OFFSET)
+        info->max_tmds_clock =
+            hdmi_vendor_specific_data_block_get_max_tmds_clock((const uint8_t *) vsdb) * 5;
+}
+
+static const struct edid_visitor edid_info_cea861_visitor = {
+    .detailed_timing        = edid_info_visit_detailed_timing,
+    .short_video_descriptor = edid_info_visit_svd,
+    .vendor_specific        = edid_info_visit_vsdb,
+};
+
+static void
+edid_info_decode_cea861(struct edid_info * const info,
+                        const struct cea861_timing_block * const ctb,
+                        const uint8_t block)
+{
+    if (cea861_timing_block_get_revision((const uint8_t *) ctb) >= 2)
+        info->basic_audio = info->basic_audio ||
+                            cea861_timing_block_get_basic_audio_supported((const uint8_t *) ctb);
+
+    cea861_visit(ctb, block, &edid_info_cea861_visitor, info);
+}
+
+bool
+edid_info_decode(struct edid_info * const info, const uint8_t * const data,
+                 const size_t length)
+{
+    const struct edid * const edid = (struct edid *) data;
+    size_t blocks;
+
+    memset(info, 0, sizeof(*info));
+
+    if (length < EDID_BLOCK_SIZE || memcmp(data, EDID_HEADER, sizeof(EDID_HEADER)))
+        return false;
+
+    edid_info_decode_base(info, edid);
+
+    blocks = length / EDID_BLOCK_SIZE;
+    if (blocks > (size_t) edid_get_extensions(data) + 1)
+        blocks = edid_get_extensions(data) + 1;
+
+    for (size_t i = 1; i < blocks; i++) {
+        const uint8_t * const block = data + i * EDID_BLOCK_SIZE;
+
+        if (block[0] == EDID_EXTENSION_CEA)
+            edid_info_decode_cea861(info, (struct cea861_timing_block *) block, i);
+    }
+
+    edid_quirk_apply(edid_quirk_find(data), info);
+
+    return true;
+}
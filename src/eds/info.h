@@ -0,0 +1,97 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_info_h
+#define eds_info_h
+
+#include <stddef.h>
+
+#include "edid.h"
+
+#define EDID_INFO_MAX_MODES                     (0x40)
+
+enum edid_mode_source {
+    EDID_MODE_SOURCE_DETAILED_TIMING,
+    EDID_MODE_SOURCE_STANDARD_TIMING,
+    EDID_MODE_SOURCE_CEA861_VIC,
+};
+
+struct edid_mode {
+    uint16_t hactive;
+    uint16_t vactive;
+    uint32_t pixel_clock;                       /* kHz */
+    uint32_t refresh;                           /* mHz */
+    uint8_t  source;                            /* enum edid_mode_source */
+    uint8_t  vic;
+
+    unsigned interlaced : 1;
+    unsigned preferred  : 1;
+    unsigned native     : 1;
+};
+
+/*!
+ * A flattened, pointer-free summary of an EDID.  It may be copied (or shared)
+ * freely and is what the caching layers hand out to consumers.
+ */
+struct edid_info {
+    char                           manufacturer[4];
+    uint16_t                       product;
+    uint32_t                       serial_number;
+    edid_monitor_descriptor_string name;
+
+    uint8_t                        version;
+    uint8_t                        revision;
+    uint8_t                        extensions;
+
+    bool                           digital;
+    uint16_t                       width;       /* mm */
+    uint16_t                       height;      /* mm */
+
+    bool                           basic_audio;
+    bool                           hdmi;
+    uint16_t                       physical_address;
+    uint16_t                       max_tmds_clock;  /* MHz, 0 if unknown */
+
+    uint32_t                       quirks;      /* enum edid_quirk_flags */
+
+    uint8_t                        modes;
+    struct edid_mode               mode[EDID_INFO_MAX_MODES];
+};
+
+/*!
+ * Decode the EDID in \p data into \p info.  Only the blocks which are present
+ * in \p length are consulted, and any quirk which is known for the display is
+ * applied to the result.  Returns false if the base block is missing or
+ * malformed.
+ */
+bool
+edid_info_decode(struct edid_info *info, const uint8_t *data, size_t length);
+
+#endif
@@ -0,0 +1,501 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#include "edid.h"
+#include "input.h"
+
+/* the characters of EDID_HEADER fixed in base64, and the first to search for */
+static const char EDID_HEADER_BASE64[] = "AP///////w";
+#define EDID_HEADER_BASE64_SLASH                (2)
+
+struct eds_input {
+    uint8_t *data;
+    size_t capacity;
+
+    /* digits or base64 characters with the whitespace and noise removed */
+    uint8_t *text;
+    size_t text_capacity;
+
+#if defined(__SSSE3__)
+    /* pshufb controls gathering the bytes selected by an 8-bit mask */
+    uint8_t compact[0x100][8];
+#endif
+};
+
+struct eds_input *
+eds_input_new(void)
+{
+    struct eds_input *input;
+
+    if (!(input = calloc(1, sizeof(*input))))
+        return NULL;
+
+#if defined(__SSSE3__)
+    for (unsigned mask = 0; mask < 0x100; mask++) {
+        unsigned n = 0;
+
+        memset(input->compact[mask], 0x80, sizeof(input->compact[mask]));
+        for (unsigned i = 0; i < 8; i++)
+            if (mask & (1 << i))
+                input->compact[mask][n++] = i;
+    }
+#endif
+
+    return input;
+}
+
+void
+eds_input_free(struct eds_input *input)
+{
+    if (!input)
+        return;
+
+    free(input->data);
+    free(input->text);
+    free(input);
+}
+
+static bool
+_reserve(uint8_t ** const buffer, size_t * const capacity, const size_t size)
+{
+    uint8_t *grown;
+
+    if (size <= *capacity)
+        return true;
+
+    if (!(grown = realloc(*buffer, size)))
+        return false;
+
+    *buffer = grown;
+    *capacity = size;
+    return true;
+}
+
+static inline bool
+_is_space(const uint8_t c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline bool
+_is_hex(const uint8_t c)
+{
+    return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'f');
+}
+
+static inline bool
+_is_separator(const uint8_t c)
+{
+    return c == ':' || c == ']' || c == '>';
+}
+
+static inline int
+_base64_value(const uint8_t c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    return -1;
+}
+
+enum eds_input_format
+eds_input_detect(const uint8_t * const data, const size_t length)
+{
+    const size_t prefix = length < EDID_BLOCK_SIZE * 2 ? length : EDID_BLOCK_SIZE * 2;
+    const uint8_t *slash;
+
+    if (length >= sizeof(EDID_HEADER) &&
+        !memcmp(data, EDID_HEADER, sizeof(EDID_HEADER)))
+        return EDS_INPUT_FORMAT_BINARY;
+
+    /* text has no control characters other than whitespace */
+    for (size_t i = 0; i < prefix; i++)
+        if ((data[i] < 0x20 && data[i] != '\t' && data[i] != '\n' &&
+             data[i] != '\r') || data[i] == 0x7f)
+            return EDS_INPUT_FORMAT_BINARY;
+
+    for (slash = data + EDID_HEADER_BASE64_SLASH;
+         slash < data + length &&
+         (slash = memchr(slash, '/', data + length - slash));
+         slash++)
+        if ((size_t) (data + length - slash) >=
+                sizeof(EDID_HEADER_BASE64) - 1 - EDID_HEADER_BASE64_SLASH &&
+            !memcmp(slash - EDID_HEADER_BASE64_SLASH, EDID_HEADER_BASE64,
+                    sizeof(EDID_HEADER_BASE64) - 1))
+            return EDS_INPUT_FORMAT_BASE64;
+
+    return EDS_INPUT_FORMAT_HEX;
+}
+
+/*
+ * Append the hex digits of the line [p, end) to \p line.  The payload follows
+ * the last separator and ends at a '|' opening an ASCII column, in which case
+ * the line is hexdump -C output and leads with an offset; a payload with
+ * anything but digits and whitespace, or with an odd number of digits, is
+ * dropped.  Returns the end of the digits.
+ */
+static uint8_t *
+_hex_line(const struct eds_input * const input, const uint8_t *p,
+          const uint8_t *end, uint8_t * const line)
+{
+    const uint8_t *bar;
+    uint8_t *out = line;
+    bool noise = false;
+
+    if ((bar = memchr(p, '|', end - p))) {
+        const uint8_t *offset;
+
+        end = bar;
+
+        while (p < end && _is_space(*p))
+            p++;
+        for (offset = p; p < end && _is_hex(*p); p++)
+            ;
+        if (p - offset <= 2 || p == end || !_is_space(*p))
+            p = offset;
+    }
+
+#if defined(__SSE2__)
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+
+    while (end - p >= 16) {
+        const __m128i c = _mm_loadu_si128((const __m128i *) p);
+        const __m128i lower = _mm_or_si128(c, case_bit);
+        const __m128i digit =
+            _mm_or_si128(_mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                       _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1))),
+                         _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                       _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1))));
+        const __m128i space =
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8(' ')),
+                                      _mm_cmpeq_epi8(c, _mm_set1_epi8('\t'))),
+                         _mm_cmpeq_epi8(c, _mm_set1_epi8('\r')));
+        const __m128i separator =
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8(':')),
+                                      _mm_cmpeq_epi8(c, _mm_set1_epi8(']'))),
+                         _mm_cmpeq_epi8(c, _mm_set1_epi8('>')));
+        unsigned digits = _mm_movemask_epi8(digit);
+        unsigned spaces = _mm_movemask_epi8(space);
+        const unsigned separators = _mm_movemask_epi8(separator);
+
+        if (separators) {
+            /* everything up to the last separator is prefix */
+            const unsigned prefix = 0xffffu >> (15 - (31 - __builtin_clz(separators)));
+
+            out = line;
+            noise = false;
+            digits = digits & ~prefix;
+            spaces = spaces | prefix;
+        }
+
+        if ((digits | spaces) != 0xffff)
+            noise = true;
+
+        if (noise) {
+            /* the payload may yet restart after a separator */
+        } else if (digits == 0xffff) {
+            _mm_storeu_si128((__m128i *) out, c);
+            out = out + 16;
+        } else if (digits) {
+#if defined(__SSSE3__)
+            const __m128i lo =
+                _mm_loadl_epi64((const __m128i *) input->compact[digits & 0xff]);
+            const __m128i hi =
+                _mm_loadl_epi64((const __m128i *) input->compact[digits >> 8]);
+
+            _mm_storel_epi64((__m128i *) out, _mm_shuffle_epi8(c, lo));
+            out = out + __builtin_popcount(digits & 0xff);
+            _mm_storel_epi64((__m128i *) out,
+                             _mm_shuffle_epi8(_mm_srli_si128(c, 8), hi));
+            out = out + __builtin_popcount(digits >> 8);
+#else
+            for (; digits; digits &= digits - 1)
+                *out++ = p[__builtin_ctz(digits)];
+#endif
+        }
+
+        p = p + 16;
+    }
+#endif
+
+    (void) input;
+
+    for (; p < end; p++) {
+        if (_is_separator(*p)) {
+            out = line;
+            noise = false;
+        } else if (_is_hex(*p)) {
+            if (!noise)
+                *out++ = *p;
+        } else if (!_is_space(*p)) {
+            noise = true;
+        }
+    }
+
+    if (noise || (out - line) % 2)
+        return line;
+    return out;
+}
+
+/* convert \p count (even) hex digits to bytes */
+static void
+_hex_convert(const uint8_t *digits, size_t count, uint8_t *out)
+{
+#if defined(__SSE2__)
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i low = _mm_set1_epi16(0x00ff);
+
+    /*
+     * Each digit becomes its value: the low nibble, plus nine for letters.
+     * Pairs are then joined within 16-bit lanes (the high digit is the low
+     * byte) and narrowed.
+     */
+    for (; count >= 32; count -= 32, digits += 32, out += 16) {
+        const __m128i a = _mm_loadu_si128((const __m128i *) digits);
+        const __m128i b = _mm_loadu_si128((const __m128i *) (digits + 16));
+        const __m128i va =
+            _mm_add_epi8(_mm_and_si128(a, nibble),
+                         _mm_and_si128(_mm_cmpgt_epi8(a, _mm_set1_epi8('9')), nine));
+        const __m128i vb =
+            _mm_add_epi8(_mm_and_si128(b, nibble),
+                         _mm_and_si128(_mm_cmpgt_epi8(b, _mm_set1_epi8('9')), nine));
+        const __m128i ra = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(va, low), 4),
+                                        _mm_srli_epi16(va, 8));
+        const __m128i rb = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(vb, low), 4),
+                                        _mm_srli_epi16(vb, 8));
+
+        _mm_storeu_si128((__m128i *) out, _mm_packus_epi16(ra, rb));
+    }
+#endif
+
+    for (; count >= 2; count -= 2, digits += 2) {
+        const uint8_t hi = (digits[0] & 0x0f) + (digits[0] > '9' ? 9 : 0);
+        const uint8_t lo = (digits[1] & 0x0f) + (digits[1] > '9' ? 9 : 0);
+
+        *out++ = (hi << 4) | lo;
+    }
+}
+
+static size_t
+_decode_hex(struct eds_input * const input, const uint8_t * const data,
+            const size_t length)
+{
+    const uint8_t *line = data, *eol;
+    uint8_t *out;
+    size_t digits;
+
+    /* the stores in _hex_line may write up to 16 bytes past the digits */
+    if (!_reserve(&input->text, &input->text_capacity, length + 16) ||
+        !_reserve(&input->data, &input->capacity, length / 2 + 1))
+        return 0;
+
+    for (out = input->text; line < data + length; line = eol + 1) {
+        if (!(eol = memchr(line, '\n', data + length - line)))
+            eol = data + length;
+        out = _hex_line(input, line, eol, out);
+    }
+
+    digits = out - input->text;
+    _hex_convert(input->text, digits, input->data);
+    return digits / 2;
+}
+
+static size_t
+_decode_base64(struct eds_input * const input, const uint8_t *p,
+               const size_t length)
+{
+    const uint8_t * const end = p + length;
+    const uint8_t *text;
+    uint8_t *out;
+    size_t count;
+
+    /* the stores below may write up to 16 bytes past the text and data */
+    if (!_reserve(&input->text, &input->text_capacity, length + 16) ||
+        !_reserve(&input->data, &input->capacity, length / 4 * 3 + 16))
+        return 0;
+
+    /* gather the alphabet up to the first character which is neither it nor whitespace */
+    out = input->text;
+
+#if defined(__SSE2__)
+    while (end - p >= 16) {
+        const __m128i c = _mm_loadu_si128((const __m128i *) p);
+        const __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+        const __m128i alphabet =
+            _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                                    _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1))),
+                                      _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                                    _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)))),
+                         _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('+')),
+                                      _mm_cmpeq_epi8(c, _mm_set1_epi8('/'))));
+
+        if (_mm_movemask_epi8(alphabet) != 0xffff)
+            break;
+
+        _mm_storeu_si128((__m128i *) out, c);
+        out = out + 16;
+        p = p + 16;
+    }
+#endif
+
+    for (; p < end; p++) {
+        if (_base64_value(*p) >= 0)
+            *out++ = *p;
+        else if (!_is_space(*p) && *p != '\n')
+            break;
+    }
+
+    count = out - input->text;
+    text = input->text;
+    out = input->data;
+
+#if defined(__SSSE3__)
+    {
+        const __m128i nibble = _mm_set1_epi8(0x0f);
+        const __m128i roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                           0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i order = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                            -1, -1, -1, -1);
+
+        /*
+         * The high nibble selects the offset from ASCII to the sextet, '/'
+         * being told from '+' by its own comparison.  Sextets are then
+         * merged into pairs, the pairs into 24-bit lanes, and the three
+         * bytes of each lane reversed into place.
+         */
+        for (; count >= 16; count -= 16, text += 16, out += 12) {
+            const __m128i c = _mm_loadu_si128((const __m128i *) text);
+            const __m128i hi = _mm_and_si128(_mm_srli_epi32(c, 4), nibble);
+            const __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+            const __m128i values =
+                _mm_add_epi8(c, _mm_shuffle_epi8(roll, _mm_add_epi8(slash, hi)));
+            const __m128i pairs =
+                _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            const __m128i lanes =
+                _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+            _mm_storeu_si128((__m128i *) out, _mm_shuffle_epi8(lanes, order));
+        }
+    }
+#endif
+
+    for (; count >= 2; count = count >= 4 ? count - 4 : 0, text += 4) {
+        const uint32_t word =
+            (uint32_t) _base64_value(text[0]) << 18 |
+            (uint32_t) _base64_value(text[1]) << 12 |
+            (uint32_t) (count > 2 ? _base64_value(text[2]) : 0) << 6 |
+            (uint32_t) (count > 3 ? _base64_value(text[3]) : 0);
+
+        *out++ = word >> 16;
+        if (count > 2)
+            *out++ = word >> 8;
+        if (count > 3)
+            *out++ = word;
+    }
+
+    return out - input->data;
+}
+
+enum eds_input_format
+eds_input_decode(struct eds_input *input, const uint8_t *data, size_t length,
+                 const uint8_t **edid, size_t *size)
+{
+    const enum eds_input_format format = eds_input_detect(data, length);
+    const uint8_t *header;
+    size_t decoded, blocks;
+
+    switch (format) {
+    case EDS_INPUT_FORMAT_BINARY:
+        *edid = data;
+        *size = length;
+        return format;
+    case EDS_INPUT_FORMAT_HEX:
+        decoded = _decode_hex(input, data, length);
+        break;
+    case EDS_INPUT_FORMAT_BASE64: {
+        /* eds_input_detect has found the header */
+        const uint8_t *slash = data + EDID_HEADER_BASE64_SLASH;
+
+        while ((slash = memchr(slash, '/', data + length - slash)) &&
+               memcmp(slash - EDID_HEADER_BASE64_SLASH, EDID_HEADER_BASE64,
+                      sizeof(EDID_HEADER_BASE64) - 1))
+            slash++;
+
+        decoded = _decode_base64(input, slash - EDID_HEADER_BASE64_SLASH,
+                                 data + length - slash + EDID_HEADER_BASE64_SLASH);
+        break;
+    }
+    default:
+        return EDS_INPUT_FORMAT_UNKNOWN;
+    }
+
+    for (header = input->data;
+         decoded >= sizeof(EDID_HEADER) &&
+         header <= input->data + decoded - sizeof(EDID_HEADER);
+         header++)
+        if (!memcmp(header, EDID_HEADER, sizeof(EDID_HEADER)))
+            break;
+
+    if (decoded < sizeof(EDID_HEADER) ||
+        header > input->data + decoded - sizeof(EDID_HEADER))
+        return EDS_INPUT_FORMAT_UNKNOWN;
+
+    *edid = header;
+    *size = input->data + decoded - header;
+
+    /* trim to the declared extensions, leaving short input to the caller */
+    if (*size >= EDID_BLOCK_SIZE) {
+        blocks = (size_t) edid_get_extensions(header) + 1;
+        if (*size > blocks * EDID_BLOCK_SIZE)
+            *size = blocks * EDID_BLOCK_SIZE;
+    }
+
+    return format;
+}
+
@@ -0,0 +1,85 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_input_h
+#define eds_input_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum eds_input_format {
+    EDS_INPUT_FORMAT_UNKNOWN,
+    EDS_INPUT_FORMAT_BINARY,
+    EDS_INPUT_FORMAT_HEX,
+    EDS_INPUT_FORMAT_BASE64,
+};
+
+/*!
+ * Buffers for decoding EDIDs given as text, reused from one input to the
+ * next so that decoding a corpus does not allocate per file.
+ */
+struct eds_input;
+
+struct eds_input *
+eds_input_new(void);
+
+void
+eds_input_free(struct eds_input *input);
+
+/*!
+ * Classify \p data: binary when it begins with the EDID header or is not
+ * text, base64 when it contains the encoding of the EDID header, hex
+ * otherwise.
+ */
+enum eds_input_format
+eds_input_detect(const uint8_t *data, size_t length);
+
+/*!
+ * Locate the EDID in \p data and point \p edid at it.  Binary input is
+ * returned in place; text is decoded into \p input, valid until its next use.
+ *
+ * Hex may be separated by any whitespace and is read line by line: leading
+ * [timestamp] and <level> groups and everything up to the last ':' are
+ * skipped (xrandr --verbose, kernel logs, edid-decode), as are the offset
+ * and trailing |ascii| columns of hexdump -C; lines with anything else are
+ * ignored.  Base64 is read from
+ * the encoded header to the first character outside the alphabet, so it may
+ * be embedded in JSON.  The first EDID in the text is returned, trimmed to
+ * the extensions it declares.
+ *
+ * Returns the format, or EDS_INPUT_FORMAT_UNKNOWN if no EDID was found in
+ * text or memory could not be allocated.
+ */
+enum eds_input_format
+eds_input_decode(struct eds_input *input, const uint8_t *data, size_t length,
+                 const uint8_t **edid, size_t *size);
+
+#endif
+
@@ -31,7 +31,9 @@
 #ifndef eds_macros_h
 #define eds_macros_h
 
+#if !defined(ARRAY_SIZE)
 #define ARRAY_SIZE(arr)                         (sizeof(arr) / sizeof(arr[0]))
+#endif
 
 #endif
 
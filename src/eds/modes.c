@@ -0,0 +1,553 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "edid.h"
+#include "cea861.h"
+#include "modes.h"
+
+/* distinct modes tracked for de-duplication; more than this are not reported */
+#define EDID_DRM_MODES_MAX                      (0x100)
+
+#define EDID_STANDARD_TIMINGS_MAX               (0x40)
+
+enum { NEGATIVE, POSITIVE };
+
+static const struct edid_cea861_sync {
+    uint16_t hfront;
+    uint16_t hsync;
+    uint8_t  vfront;
+    uint8_t  vsync;
+    uint8_t  flags;
+    uint8_t  repetition;
+} cea861_syncs[] = {
+#define CEA861_SYNC(vic, hfront, hsync, hpolarity, vfront, vsync, vpolarity,   \
+                    repetition)                                                 \
+    [vic] = { hfront, hsync, vfront, vsync,                                     \
+              ((hpolarity) == POSITIVE ? EDID_DRM_MODE_FLAG_PHSYNC              \
+                                       : EDID_DRM_MODE_FLAG_NHSYNC) |           \
+              ((vpolarity) == POSITIVE ? EDID_DRM_MODE_FLAG_PVSYNC              \
+                                       : EDID_DRM_MODE_FLAG_NVSYNC),            \
+              repetition },
+#include "cea861-timings.def"
+};
+
+/* VESA DMT 1.0 r13: the standard blanking, progressive modes, in kHz */
+static const struct edid_dmt_timing {
+    uint16_t hdisplay, hsync_start, hsync_end, htotal;
+    uint16_t vdisplay, vsync_start, vsync_end, vtotal;
+    uint8_t  vrefresh;
+    uint8_t  flags;
+    uint32_t clock;
+} dmt_timings[] = {
+#define DMT(hdisplay, hsync_start, hsync_end, htotal, hpolarity, vdisplay,      \
+            vsync_start, vsync_end, vtotal, vpolarity, vrefresh, clock)         \
+    { hdisplay, hsync_start, hsync_end, htotal,                                 \
+      vdisplay, vsync_start, vsync_end, vtotal, vrefresh,                       \
+      ((hpolarity) == POSITIVE ? EDID_DRM_MODE_FLAG_PHSYNC                      \
+                               : EDID_DRM_MODE_FLAG_NHSYNC) |                   \
+      ((vpolarity) == POSITIVE ? EDID_DRM_MODE_FLAG_PVSYNC                      \
+                               : EDID_DRM_MODE_FLAG_NVSYNC),                    \
+      clock },
+    DMT( 640,  656,  752,  800, NEGATIVE,  480,  490,  492,  525, NEGATIVE, 60,  25175)
+    DMT( 640,  664,  704,  832, NEGATIVE,  480,  489,  492,  520, NEGATIVE, 72,  31500)
+    DMT( 640,  656,  720,  840, NEGATIVE,  480,  481,  484,  500, NEGATIVE, 75,  31500)
+    DMT( 640,  696,  752,  832, NEGATIVE,  480,  481,  484,  509, NEGATIVE, 85,  36000)
+    DMT( 800,  824,  896, 1024, POSITIVE,  600,  601,  603,  625, POSITIVE, 56,  36000)
+    DMT( 800,  840,  968, 1056, POSITIVE,  600,  601,  605,  628, POSITIVE, 60,  40000)
+    DMT( 800,  856,  976, 1040, POSITIVE,  600,  637,  643,  666, POSITIVE, 72,  50000)
+    DMT( 800,  816,  896, 1056, POSITIVE,  600,  601,  604,  625, POSITIVE, 75,  49500)
+    DMT( 800,  832,  896, 1048, POSITIVE,  600,  601,  604,  631, POSITIVE, 85,  56250)
+    DMT( 848,  864,  976, 1088, POSITIVE,  480,  486,  494,  517, POSITIVE, 60,  33750)
+    DMT(1024, 1048, 1184, 1344, NEGATIVE,  768,  771,  777,  806, NEGATIVE, 60,  65000)
+    DMT(1024, 1048, 1184, 1328, NEGATIVE,  768,  771,  777,  806, NEGATIVE, 70,  75000)
+    DMT(1024, 1040, 1136, 1312, POSITIVE,  768,  769,  772,  800, POSITIVE, 75,  78750)
+    DMT(1024, 1072, 1168, 1376, POSITIVE,  768,  769,  772,  808, POSITIVE, 85,  94500)
+    DMT(1152, 1216, 1344, 1600, POSITIVE,  864,  865,  868,  900, POSITIVE, 75, 108000)
+    DMT(1280, 1390, 1430, 1650, POSITIVE,  720,  725,  730,  750, POSITIVE, 60,  74250)
+    DMT(1280, 1344, 1472, 1664, NEGATIVE,  768,  771,  778,  798, POSITIVE, 60,  79500)
+    DMT(1280, 1360, 1488, 1696, NEGATIVE,  768,  771,  778,  805, POSITIVE, 75, 102250)
+    DMT(1280, 1360, 1496, 1712, NEGATIVE,  768,  771,  778,  809, POSITIVE, 85, 117500)
+    DMT(1280, 1352, 1480, 1680, NEGATIVE,  800,  803,  809,  831, POSITIVE, 60,  83500)
+    DMT(1280, 1360, 1488, 1696, NEGATIVE,  800,  803,  809,  838, POSITIVE, 75, 106500)
+    DMT(1280, 1360, 1496, 1712, NEGATIVE,  800,  803,  809,  843, POSITIVE, 85, 122500)
+    DMT(1280, 1376, 1488, 1800, POSITIVE,  960,  961,  964, 1000, POSITIVE, 60, 108000)
+    DMT(1280, 1344, 1504, 1728, POSITIVE,  960,  961,  964, 1011, POSITIVE, 85, 148500)
+    DMT(1280, 1328, 1440, 1688, POSITIVE, 1024, 1025, 1028, 1066, POSITIVE, 60, 108000)
+    DMT(1280, 1296, 1440, 1688, POSITIVE, 1024, 1025, 1028, 1066, POSITIVE, 75, 135000)
+    DMT(1280, 1344, 1504, 1728, POSITIVE, 1024, 1025, 1028, 1072, POSITIVE, 85, 157500)
+    DMT(1360, 1424, 1536, 1792, POSITIVE,  768,  771,  777,  795, POSITIVE, 60,  85500)
+    DMT(1366, 1436, 1579, 1792, POSITIVE,  768,  771,  774,  798, POSITIVE, 60,  85500)
+    DMT(1400, 1488, 1632, 1864, NEGATIVE, 1050, 1053, 1057, 1089, POSITIVE, 60, 121750)
+    DMT(1400, 1504, 1648, 1896, NEGATIVE, 1050, 1053, 1057, 1099, POSITIVE, 75, 156000)
+    DMT(1400, 1504, 1656, 1912, NEGATIVE, 1050, 1053, 1057, 1105, POSITIVE, 85, 179500)
+    DMT(1440, 1520, 1672, 1904, NEGATIVE,  900,  903,  909,  934, POSITIVE, 60, 106500)
+    DMT(1440, 1536, 1688, 1936, NEGATIVE,  900,  903,  909,  942, POSITIVE, 75, 136750)
+    DMT(1440, 1544, 1696, 1952, NEGATIVE,  900,  903,  909,  948, POSITIVE, 85, 157000)
+    DMT(1600, 1664, 1856, 2160, POSITIVE, 1200, 1201, 1204, 1250, POSITIVE, 60, 162000)
+    DMT(1600, 1664, 1856, 2160, POSITIVE, 1200, 1201, 1204, 1250, POSITIVE, 65, 175500)
+    DMT(1600, 1664, 1856, 2160, POSITIVE, 1200, 1201, 1204, 1250, POSITIVE, 70, 189000)
+    DMT(1600, 1664, 1856, 2160, POSITIVE, 1200, 1201, 1204, 1250, POSITIVE, 75, 202500)
+    DMT(1600, 1664, 1856, 2160, POSITIVE, 1200, 1201, 1204, 1250, POSITIVE, 85, 229500)
+    DMT(1680, 1784, 1960, 2240, NEGATIVE, 1050, 1053, 1059, 1089, POSITIVE, 60, 146250)
+    DMT(1680, 1800, 1976, 2272, NEGATIVE, 1050, 1053, 1059, 1099, POSITIVE, 75, 187000)
+    DMT(1680, 1808, 1984, 2288, NEGATIVE, 1050, 1053, 1059, 1105, POSITIVE, 85, 214750)
+    DMT(1792, 1920, 2120, 2448, NEGATIVE, 1344, 1345, 1348, 1394, POSITIVE, 60, 204750)
+    DMT(1792, 1888, 2104, 2456, NEGATIVE, 1344, 1345, 1348, 1417, POSITIVE, 75, 261000)
+    DMT(1856, 1952, 2176, 2528, NEGATIVE, 1392, 1393, 1396, 1439, POSITIVE, 60, 218250)
+    DMT(1856, 1984, 2208, 2560, NEGATIVE, 1392, 1393, 1396, 1500, POSITIVE, 75, 288000)
+    DMT(1920, 2008, 2052, 2200, POSITIVE, 1080, 1084, 1089, 1125, POSITIVE, 60, 148500)
+    DMT(1920, 2056, 2256, 2592, NEGATIVE, 1200, 1203, 1209, 1245, POSITIVE, 60, 193250)
+    DMT(1920, 2056, 2264, 2608, NEGATIVE, 1200, 1203, 1209, 1255, POSITIVE, 75, 245250)
+    DMT(1920, 2064, 2272, 2624, NEGATIVE, 1200, 1203, 1209, 1262, POSITIVE, 85, 281250)
+    DMT(1920, 2048, 2256, 2600, NEGATIVE, 1440, 1441, 1444, 1500, POSITIVE, 60, 234000)
+    DMT(1920, 2064, 2288, 2640, NEGATIVE, 1440, 1441, 1444, 1500, POSITIVE, 75, 297000)
+    DMT(2560, 2752, 3032, 3504, NEGATIVE, 1600, 1603, 1609, 1658, POSITIVE, 60, 348500)
+    DMT(2560, 2768, 3048, 3536, NEGATIVE, 1600, 1603, 1609, 1672, POSITIVE, 75, 443250)
+    DMT(2560, 2768, 3048, 3536, NEGATIVE, 1600, 1603, 1609, 1682, POSITIVE, 85, 505250)
+#undef DMT
+};
+
+struct edid_drm_modes_state {
+    struct edid_drm_mode *modes;
+    size_t               capacity;
+    size_t               count;
+    uint64_t             keys[EDID_DRM_MODES_MAX];
+
+    /* the first descriptor, if it holds the preferred timing */
+    const uint8_t        *preferred;
+
+    /* standard timings outside DMT are CVT as of 1.4, GTF before */
+    bool                 cvt;
+
+    /* VICs and standard timings are emitted after every detailed timing */
+    uint8_t              vics[256];
+    uint16_t             nvics;
+    uint64_t             seen[4];
+    const struct edid_standard_timing_descriptor *stds[EDID_STANDARD_TIMINGS_MAX];
+    uint8_t              nstds;
+};
+
+static void
+_name(struct edid_drm_mode * const mode, const bool interlaced)
+{
+    char digits[5];
+    size_t length = 0;
+
+    for (unsigned i = 0; i < 2; i++) {
+        uint16_t value = i ? mode->vdisplay : mode->hdisplay;
+        size_t n = 0;
+
+        do {
+            digits[n++] = '0' + value % 10;
+            value /= 10;
+        } while (value && n < sizeof(digits));
+
+        if (i)
+            mode->name[length++] = 'x';
+        while (n)
+            mode->name[length++] = digits[--n];
+    }
+
+    if (interlaced)
+        mode->name[length++] = 'i';
+    mode->name[length] = '\0';
+}
+
+static void
+_emit(struct edid_drm_modes_state * const state,
+      const struct edid_drm_mode * const mode)
+{
+    const bool interlaced = mode->flags & EDID_DRM_MODE_FLAG_INTERLACE;
+    const uint64_t key = (uint64_t) mode->hdisplay << 48 |
+                         (uint64_t) mode->vdisplay << 32 |
+                         (uint64_t) mode->vrefresh << 1 | interlaced;
+
+    for (size_t i = 0; i < state->count; i++)
+        if (state->keys[i] == key)
+            return;
+
+    if (state->count == EDID_DRM_MODES_MAX)
+        return;
+
+    state->keys[state->count] = key;
+    if (state->count < state->capacity) {
+        state->modes[state->count] = *mode;
+        _name(&state->modes[state->count], interlaced);
+    }
+    state->count++;
+}
+
+/* vertical refresh in Hz, rounded, as the kernel computes it */
+static uint32_t
+_vrefresh(const struct edid_drm_mode * const mode)
+{
+    const uint64_t frame = (uint64_t) mode->htotal * mode->vtotal;
+    uint64_t clock = (uint64_t) mode->clock * 1000;
+
+    if (!frame)
+        return 0;
+
+    if (mode->flags & EDID_DRM_MODE_FLAG_INTERLACE)
+        clock <<= 1;
+
+    return (clock + frame / 2) / frame;
+}
+
+static void
+_detailed_timing(void * const context, const uint8_t block,
+                 const struct edid_detailed_timing_descriptor * const dtd)
+{
+    struct edid_drm_modes_state * const state = context;
+    const uint8_t * const data = (const uint8_t *) dtd;
+    const uint16_t hactive = edid_detailed_timing_horizontal_active(dtd);
+    const uint16_t vactive = edid_detailed_timing_vertical_active(dtd);
+    const uint16_t hsync_offset = edid_detailed_timing_horizontal_sync_offset(dtd);
+    const uint16_t vsync_offset = edid_detailed_timing_vertical_sync_offset(dtd);
+    struct edid_drm_mode mode = {
+        .clock       = edid_detailed_timing_pixel_clock(dtd) / 1000,
+        .hdisplay    = hactive,
+        .hsync_start = hactive + hsync_offset,
+        .hsync_end   = hactive + hsync_offset +
+                       edid_detailed_timing_horizontal_sync_pulse_width(dtd),
+        .htotal      = hactive + edid_detailed_timing_horizontal_blanking(dtd),
+        .vdisplay    = vactive,
+        .vsync_start = vactive + vsync_offset,
+        .vsync_end   = vactive + vsync_offset +
+                       edid_detailed_timing_vertical_sync_pulse_width(dtd),
+        .vtotal      = vactive + edid_detailed_timing_vertical_blanking(dtd),
+        .type        = EDID_DRM_MODE_TYPE_DRIVER,
+    };
+
+    (void) block;
+
+    if (!hactive || !vactive)
+        return;
+
+    /* the descriptor describes a field; the mode a frame */
+    if (edid_detailed_timing_get_interlaced(data)) {
+        mode.vdisplay <<= 1;
+        mode.vsync_start <<= 1;
+        mode.vsync_end <<= 1;
+        mode.vtotal = (mode.vtotal << 1) | 1;
+        mode.flags |= EDID_DRM_MODE_FLAG_INTERLACE;
+    }
+
+    if (edid_detailed_timing_get_signal_sync(data) ==
+            EDID_SIGNAL_SYNC_DIGITAL_SEPARATE) {
+        mode.flags |= edid_detailed_timing_get_signal_pulse_polarity(data)
+                    ? EDID_DRM_MODE_FLAG_PHSYNC : EDID_DRM_MODE_FLAG_NHSYNC;
+        mode.flags |= edid_detailed_timing_get_signal_serration_polarity(data)
+                    ? EDID_DRM_MODE_FLAG_PVSYNC : EDID_DRM_MODE_FLAG_NVSYNC;
+    }
+
+    if (data == state->preferred)
+        mode.type |= EDID_DRM_MODE_TYPE_PREFERRED;
+
+    mode.vrefresh = _vrefresh(&mode);
+    _emit(state, &mode);
+}
+
+static void
+_short_video_descriptor(void * const context, const uint8_t block,
+                        const struct cea861_short_video_descriptor * const svd)
+{
+    struct edid_drm_modes_state * const state = context;
+    const uint8_t vic = cea861_short_video_descriptor_vic(svd);
+
+    (void) block;
+
+    if (!vic || state->seen[vic >> 6] & (UINT64_C(1) << (vic & 0x3f)))
+        return;
+
+    state->seen[vic >> 6] |= UINT64_C(1) << (vic & 0x3f);
+    state->vics[state->nvics++] = vic;
+}
+
+static void
+_standard_timing(void * const context, const uint8_t block,
+                 const struct edid_standard_timing_descriptor * const std)
+{
+    struct edid_drm_modes_state * const state = context;
+
+    (void) block;
+
+    if (state->nstds < ARRAY_SIZE(state->stds))
+        state->stds[state->nstds++] = std;
+}
+
+static void
+_cea861_mode(struct edid_drm_modes_state * const state, const uint8_t vic)
+{
+    const struct cea861_timing *timing;
+    const struct edid_cea861_sync *sync;
+    struct edid_drm_mode mode;
+    bool interlaced;
+    uint8_t scale;
+
+    if (vic >= ARRAY_SIZE(cea861_timings) || vic >= ARRAY_SIZE(cea861_syncs))
+        return;
+
+    timing = &cea861_timings[vic];
+    sync = &cea861_syncs[vic];
+    if (!timing->hactive || !sync->hsync)
+        return;
+
+    interlaced = timing->mode == INTERLACED;
+    scale = interlaced ? 2 : 1;
+
+    memset(&mode, 0, sizeof(mode));
+    mode.clock = lround(timing->pixclk * 1000);
+    mode.hdisplay = timing->hactive;
+    mode.hsync_start = timing->hactive + sync->hfront;
+    mode.hsync_end = mode.hsync_start + sync->hsync;
+    mode.htotal = timing->htotal;
+    mode.vdisplay = timing->vactive;
+    mode.vsync_start = timing->vactive + sync->vfront * scale;
+    mode.vsync_end = mode.vsync_start + sync->vsync * scale;
+    mode.vtotal = timing->vtotal;
+    mode.flags = sync->flags;
+    if (interlaced)
+        mode.flags |= EDID_DRM_MODE_FLAG_INTERLACE;
+    if (sync->repetition > 1)
+        mode.flags |= EDID_DRM_MODE_FLAG_DBLCLK;
+    mode.type = EDID_DRM_MODE_TYPE_DRIVER;
+    mode.vrefresh = _vrefresh(&mode);
+
+    _emit(state, &mode);
+}
+
+static bool
+_dmt_mode(struct edid_drm_modes_state * const state, const uint16_t hactive,
+          const uint16_t vactive, const uint32_t refresh)
+{
+    struct edid_drm_mode mode;
+
+    for (size_t i = 0; i < ARRAY_SIZE(dmt_timings); i++) {
+        const struct edid_dmt_timing * const dmt = &dmt_timings[i];
+
+        if (dmt->hdisplay != hactive || dmt->vdisplay != vactive ||
+            dmt->vrefresh != refresh)
+            continue;
+
+        memset(&mode, 0, sizeof(mode));
+        mode.clock = dmt->clock;
+        mode.hdisplay = dmt->hdisplay;
+        mode.hsync_start = dmt->hsync_start;
+        mode.hsync_end = dmt->hsync_end;
+        mode.htotal = dmt->htotal;
+        mode.vdisplay = dmt->vdisplay;
+        mode.vsync_start = dmt->vsync_start;
+        mode.vsync_end = dmt->vsync_end;
+        mode.vtotal = dmt->vtotal;
+        mode.flags = dmt->flags;
+        mode.type = EDID_DRM_MODE_TYPE_DRIVER;
+        mode.vrefresh = _vrefresh(&mode);
+
+        _emit(state, &mode);
+        return true;
+    }
+
+    return false;
+}
+
+/* VESA Generalized Timing Formula 1.1, default curve, progressive */
+static void
+_gtf_mode(struct edid_drm_modes_state * const state, const uint32_t hactive,
+          const uint32_t vactive, const uint32_t refresh)
+{
+    static const double CELL_GRANULARITY = 8.0;
+    static const double MIN_VSYNC_BP = 550.0;           /* us */
+    static const double MIN_PORCH = 1.0;
+    static const double V_SYNC = 3.0;
+    static const double C_PRIME = 30.0;
+    static const double M_PRIME = 300.0;
+    static const double H_SYNC_PERCENT = 8.0;
+
+    double hperiod, vsync_bp, vtotal, duty, hblank, htotal, hsync;
+    struct edid_drm_mode mode;
+
+    hperiod = (1000000.0 / refresh - MIN_VSYNC_BP) / (vactive + MIN_PORCH);
+    vsync_bp = round(MIN_VSYNC_BP / hperiod);
+    vtotal = vactive + vsync_bp + MIN_PORCH;
+    hperiod = hperiod * (1000000.0 / hperiod / vtotal) / refresh;
+
+    duty = C_PRIME - M_PRIME * hperiod / 1000.0;
+    hblank = round(hactive * duty / (100.0 - duty) / (2 * CELL_GRANULARITY)) *
+             (2 * CELL_GRANULARITY);
+    htotal = hactive + hblank;
+    hsync = round(H_SYNC_PERCENT / 100.0 * htotal / CELL_GRANULARITY) *
+            CELL_GRANULARITY;
+
+    memset(&mode, 0, sizeof(mode));
+    mode.clock = lround(htotal / hperiod * 1000);
+    mode.hdisplay = hactive;
+    mode.hsync_end = hactive + hblank / 2;
+    mode.hsync_start = mode.hsync_end - hsync;
+    mode.htotal = htotal;
+    mode.vdisplay = vactive;
+    mode.vsync_start = vactive + MIN_PORCH;
+    mode.vsync_end = mode.vsync_start + V_SYNC;
+    mode.vtotal = vtotal;
+    mode.flags = EDID_DRM_MODE_FLAG_NHSYNC | EDID_DRM_MODE_FLAG_PVSYNC;
+    mode.type = EDID_DRM_MODE_TYPE_DRIVER;
+    mode.vrefresh = _vrefresh(&mode);
+
+    _emit(state, &mode);
+}
+
+/* VESA Coordinated Video Timings 1.1, standard blanking */
+static void
+_cvt_mode(struct edid_drm_modes_state * const state,
+          const struct edid_standard_timing_descriptor * const std)
+{
+    static const double CELL_GRANULARITY = 8.0;
+    static const double MIN_VSYNC_BP = 550.0;           /* us */
+    static const double MIN_V_PORCH = 3.0;
+    static const double MIN_V_BPORCH = 6.0;
+    static const double C_PRIME = 30.0;
+    static const double M_PRIME = 300.0;
+    static const double H_SYNC_PERCENT = 8.0;
+    static const double CLOCK_STEP = 0.25;              /* MHz */
+
+    const uint32_t hactive = edid_standard_timing_horizontal_active(std);
+    const uint32_t vactive = edid_standard_timing_vertical_active(std);
+    const uint32_t refresh = edid_standard_timing_refresh_rate(std);
+    double hperiod, duty, hblank, htotal, vsync_bp, vsync, clock, hsync;
+    struct edid_drm_mode mode;
+
+    switch (edid_standard_timing_get_image_aspect_ratio((const uint8_t *) std)) {
+    case EDID_ASPECT_RATIO_4_3:   vsync = 4; break;
+    case EDID_ASPECT_RATIO_16_9:  vsync = 5; break;
+    case EDID_ASPECT_RATIO_16_10: vsync = 6; break;
+    case EDID_ASPECT_RATIO_5_4:   vsync = 7; break;
+    default:                      vsync = 10; break;
+    }
+
+    hperiod = (1000000.0 / refresh - MIN_VSYNC_BP) / (vactive + MIN_V_PORCH);
+
+    vsync_bp = floor(MIN_VSYNC_BP / hperiod) + 1;
+    if (vsync_bp < vsync + MIN_V_BPORCH)
+        vsync_bp = vsync + MIN_V_BPORCH;
+
+    duty = C_PRIME - M_PRIME * hperiod / 1000.0;
+    if (duty < 20.0)
+        duty = 20.0;
+
+    hblank = floor(hactive * duty / (100.0 - duty) / (2 * CELL_GRANULARITY)) *
+             (2 * CELL_GRANULARITY);
+    htotal = hactive + hblank;
+    clock = floor(htotal / hperiod / CLOCK_STEP) * CLOCK_STEP;
+    hsync = floor(H_SYNC_PERCENT / 100.0 * htotal / CELL_GRANULARITY) *
+            CELL_GRANULARITY;
+
+    memset(&mode, 0, sizeof(mode));
+    mode.clock = lround(clock * 1000);
+    mode.hdisplay = hactive;
+    mode.hsync_end = hactive + hblank / 2;
+    mode.hsync_start = mode.hsync_end - hsync;
+    mode.htotal = htotal;
+    mode.vdisplay = vactive;
+    mode.vsync_start = vactive + MIN_V_PORCH;
+    mode.vsync_end = mode.vsync_start + vsync;
+    mode.vtotal = vactive + vsync_bp + MIN_V_PORCH;
+    mode.flags = EDID_DRM_MODE_FLAG_NHSYNC | EDID_DRM_MODE_FLAG_PVSYNC;
+    mode.type = EDID_DRM_MODE_TYPE_DRIVER;
+    mode.vrefresh = _vrefresh(&mode);
+
+    _emit(state, &mode);
+}
+
+/*
+ * A standard timing is the DMT mode of that size and rate if there is one;
+ * otherwise it is synthesised with CVT (1.4) or GTF (earlier revisions).
+ */
+static void
+_standard_mode(struct edid_drm_modes_state * const state,
+               const struct edid_standard_timing_descriptor * const std)
+{
+    const uint32_t hactive = edid_standard_timing_horizontal_active(std);
+    const uint32_t vactive = edid_standard_timing_vertical_active(std);
+    const uint32_t refresh = edid_standard_timing_refresh_rate(std);
+
+    /* 1366x768 can only be approximated in 8 pixel units */
+    if (refresh == 60 &&
+        ((hactive == 1360 && vactive == 765) ||
+         (hactive == 1368 && vactive == 769))) {
+        if (_dmt_mode(state, 1366, 768, refresh))
+            return;
+    }
+
+    if (_dmt_mode(state, hactive, vactive, refresh))
+        return;
+
+    if (state->cvt)
+        _cvt_mode(state, std);
+    else
+        _gtf_mode(state, hactive, vactive, refresh);
+}
+
+static const struct edid_visitor _modes_visitor = {
+    .standard_timing        = _standard_timing,
+    .detailed_timing        = _detailed_timing,
+    .short_video_descriptor = _short_video_descriptor,
+};
+
+size_t
+edid_drm_modes(const uint8_t * const data, const size_t length,
+               struct edid_drm_mode * const modes, const size_t count)
+{
+    struct edid_drm_modes_state state;
+
+    memset(&state, 0, sizeof(state));
+    state.modes = modes;
+    state.capacity = count;
+
+    /* the first DTD is always the preferred timing as of 1.4 */
+    if (length >= EDID_BLOCK_SIZE &&
+        (edid_get_preferred_timing_mode(data) || edid_get_revision(data) >= 4))
+        state.preferred = data + offsetof(struct edid, detailed_timings);
+    state.cvt = length >= EDID_BLOCK_SIZE && edid_get_revision(data) >= 4;
+
+    if (!edid_visit(data, length, &_modes_visitor, &state, NULL))
+        return 0;
+
+    for (uint16_t i = 0; i < state.nvics; i++)
+        _cea861_mode(&state, state.vics[i]);
+
+    for (uint8_t i = 0; i < state.nstds; i++)
+        _standard_mode(&state, state.stds[i]);
+
+    return state.count;
+}
+
@@ -0,0 +1,94 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_modes_h
+#define eds_modes_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define EDID_DRM_MODE_NAME_LENGTH               (32)
+
+/* the DRM_MODE_FLAG_* and DRM_MODE_TYPE_* values of the kernel uapi */
+#define EDID_DRM_MODE_FLAG_PHSYNC               (1 << 0)
+#define EDID_DRM_MODE_FLAG_NHSYNC               (1 << 1)
+#define EDID_DRM_MODE_FLAG_PVSYNC               (1 << 2)
+#define EDID_DRM_MODE_FLAG_NVSYNC               (1 << 3)
+#define EDID_DRM_MODE_FLAG_INTERLACE            (1 << 4)
+#define EDID_DRM_MODE_FLAG_DBLCLK               (1 << 12)
+
+#define EDID_DRM_MODE_TYPE_PREFERRED            (1 << 3)
+#define EDID_DRM_MODE_TYPE_DRIVER               (1 << 6)
+
+/*!
+ * A mode laid out as struct drm_mode_modeinfo, so that an array of these can
+ * be handed to the modeset ioctls as is.  The clock is in kHz.
+ */
+struct edid_drm_mode {
+    uint32_t clock;
+
+    uint16_t hdisplay;
+    uint16_t hsync_start;
+    uint16_t hsync_end;
+    uint16_t htotal;
+    uint16_t hskew;
+
+    uint16_t vdisplay;
+    uint16_t vsync_start;
+    uint16_t vsync_end;
+    uint16_t vtotal;
+    uint16_t vscan;
+
+    uint32_t vrefresh;
+
+    uint32_t flags;
+    uint32_t type;
+    char     name[EDID_DRM_MODE_NAME_LENGTH];
+};
+
+/*!
+ * Fill \p modes with the detailed timings, CEA-861 VICs and standard timings
+ * of the EDID in \p data, in that order of precedence, without duplicates.
+ * Only a detailed timing in the first descriptor slot of the base block is
+ * marked preferred, and only if the preferred timing bit is set or the EDID is
+ * 1.4 or later (where the bit is implied).  Standard timings are the DMT mode
+ * of that size and rate where there is one, and are otherwise synthesised
+ * with CVT (EDID 1.4) or GTF (earlier revisions).  VICs beyond 107
+ * (CTA-861-G and later) are not known and are skipped.  Nothing is allocated.
+ *
+ * Returns the number of modes found, which may exceed \p count, in which case
+ * only the first \p count have been written.
+ */
+size_t
+edid_drm_modes(const uint8_t *data, size_t length,
+               struct edid_drm_mode *modes, size_t count);
+
+#endif
+
@@ -0,0 +1,319 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "publish.h"
+
+#define EDS_PUBLISH_MAGIC                       (0x53444545)    /* EEDS */
+#define EDS_PUBLISH_VERSION                     (1)
+
+struct eds_publish_slot {
+    uint32_t               sequence;            /* odd while being written */
+    struct eds_publication publication;
+} __attribute__ (( aligned(64) ));
+
+struct eds_publish_region {
+    uint32_t                magic;
+    uint32_t                version;
+    uint32_t                slots;
+    uint32_t                size;               /* of a slot */
+    struct eds_publish_slot slot[EDS_PUBLISH_SLOTS];
+};
+
+struct eds_publisher {
+    char                      *name;
+    struct eds_publish_region *region;
+};
+
+struct eds_subscriber {
+    const struct eds_publish_region *region;
+};
+
+static inline void
+_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+struct eds_publisher *
+eds_publisher_new(const char *name)
+{
+    struct eds_publisher *publisher;
+    void *region;
+    int fd;
+
+    if (!name)
+        name = EDS_PUBLISH_DEFAULT_NAME;
+
+    if (!(publisher = calloc(1, sizeof(*publisher))))
+        return NULL;
+
+    if (!(publisher->name = strdup(name)))
+        goto error;
+
+    if ((fd = shm_open(name, O_RDWR | O_CREAT | O_CLOEXEC, 0644)) < 0)
+        goto error;
+
+    if (ftruncate(fd, sizeof(struct eds_publish_region)) < 0) {
+        close(fd);
+        goto error;
+    }
+
+    region = mmap(NULL, sizeof(struct eds_publish_region),
+                  PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED)
+        goto error;
+
+    /*
+     * A previous publisher may have left the region behind; the slots are
+     * rewritten in place so that subscribers mapping it now stay valid.  One
+     * which died mid update left an odd sequence and a torn slot: clear it and
+     * complete the update so that readers stop waiting on it.
+     */
+    publisher->region = region;
+    for (size_t i = 0; i < EDS_PUBLISH_SLOTS; i++) {
+        struct eds_publish_slot * const slot = &publisher->region->slot[i];
+        const uint32_t sequence =
+            __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED);
+
+        if (!(sequence & 1))
+            continue;
+
+        memset(&slot->publication, 0, sizeof(slot->publication));
+        __atomic_store_n(&slot->sequence, sequence + 1 ? sequence + 1 : 2,
+                         __ATOMIC_RELEASE);
+    }
+
+    publisher->region->slots = EDS_PUBLISH_SLOTS;
+    publisher->region->size = sizeof(struct eds_publish_slot);
+    publisher->region->version = EDS_PUBLISH_VERSION;
+    __atomic_store_n(&publisher->region->magic, EDS_PUBLISH_MAGIC,
+                     __ATOMIC_RELEASE);
+
+    return publisher;
+
+error:
+    free(publisher->name);
+    free(publisher);
+    return NULL;
+}
+
+void
+eds_publisher_free(struct eds_publisher * const publisher)
+{
+    if (!publisher)
+        return;
+
+    munmap(publisher->region, sizeof(struct eds_publish_region));
+    shm_unlink(publisher->name);
+    free(publisher->name);
+    free(publisher);
+}
+
+static void
+_publish(struct eds_publish_slot * const slot,
+         const struct eds_publication * const publication)
+{
+    const uint32_t sequence =
+        __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) | 1;
+
+    __atomic_store_n(&slot->sequence, sequence, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(&slot->publication, publication, sizeof(*publication));
+
+    /* skip 0 on wrap around, it marks a slot which was never published */
+    __atomic_store_n(&slot->sequence, sequence + 1 ? sequence + 1 : 2,
+                     __ATOMIC_RELEASE);
+}
+
+bool
+eds_publisher_update(struct eds_publisher * const publisher, const size_t slot,
+                     const char * const connector, const uint8_t * const data,
+                     const size_t length, const struct edid_info * const info)
+{
+    struct eds_publication publication;
+    struct eds_publish_slot *entry;
+
+    if (slot >= EDS_PUBLISH_SLOTS)
+        return false;
+
+    /* everything is prepared outside of the write side critical section */
+    memset(&publication, 0, sizeof(publication));
+    strncpy(publication.connector, connector ? connector : "",
+            sizeof(publication.connector) - 1);
+
+    if (data) {
+        publication.connected = true;
+        publication.truncated = length > EDS_PUBLISH_EDID_MAX;
+        publication.length =
+            publication.truncated ? EDS_PUBLISH_EDID_MAX : length;
+        memcpy(publication.edid, data, publication.length);
+
+        if (info) {
+            memcpy(&publication.info, info, sizeof(*info));
+            publication.valid = true;
+        } else {
+            publication.valid = edid_info_decode(&publication.info, data, length);
+        }
+    }
+
+    /* readers only observe a new sequence if the connector changed */
+    entry = &publisher->region->slot[slot];
+    if (entry->sequence &&
+        !memcmp(&entry->publication, &publication, sizeof(publication)))
+        return true;
+
+    _publish(entry, &publication);
+    return true;
+}
+
+void
+eds_publisher_clear(struct eds_publisher * const publisher, const size_t slot)
+{
+    eds_publisher_update(publisher, slot, NULL, NULL, 0, NULL);
+}
+
+struct eds_subscriber *
+eds_subscriber_new(const char *name)
+{
+    struct eds_subscriber *subscriber;
+    const struct eds_publish_region *region;
+    struct stat st;
+    void *mapping;
+    int fd;
+
+    if (!name)
+        name = EDS_PUBLISH_DEFAULT_NAME;
+
+    if ((fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0)) < 0)
+        return NULL;
+
+    if (fstat(fd, &st) < 0 ||
+        (size_t) st.st_size < sizeof(struct eds_publish_region)) {
+        close(fd);
+        return NULL;
+    }
+
+    mapping = mmap(NULL, sizeof(struct eds_publish_region), PROT_READ,
+                   MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+        return NULL;
+
+    region = mapping;
+    if (__atomic_load_n(&region->magic, __ATOMIC_ACQUIRE) != EDS_PUBLISH_MAGIC ||
+        region->version != EDS_PUBLISH_VERSION ||
+        region->slots != EDS_PUBLISH_SLOTS ||
+        region->size != sizeof(struct eds_publish_slot))
+        goto error;
+
+    if (!(subscriber = malloc(sizeof(*subscriber))))
+        goto error;
+
+    subscriber->region = region;
+    return subscriber;
+
+error:
+    munmap(mapping, sizeof(struct eds_publish_region));
+    return NULL;
+}
+
+void
+eds_subscriber_free(struct eds_subscriber * const subscriber)
+{
+    if (!subscriber)
+        return;
+
+    munmap((void *) subscriber->region, sizeof(struct eds_publish_region));
+    free(subscriber);
+}
+
+uint32_t
+eds_subscriber_sequence(const struct eds_subscriber * const subscriber,
+                        const size_t slot)
+{
+    const struct eds_publish_slot *entry;
+    uint32_t sequence;
+
+    if (slot >= EDS_PUBLISH_SLOTS)
+        return 0;
+
+    entry = &subscriber->region->slot[slot];
+
+    /* an update is a single copy; one which never ends lost its publisher */
+    for (uint32_t spins = 0;
+         (sequence = __atomic_load_n(&entry->sequence, __ATOMIC_ACQUIRE)) & 1;
+         spins++) {
+        if (spins == EDS_PUBLISH_SPINS)
+            return 0;
+        _relax();
+    }
+
+    return sequence;
+}
+
+uint32_t
+eds_subscriber_read(const struct eds_subscriber * const subscriber,
+                    const size_t slot,
+                    struct eds_publication * const publication)
+{
+    const struct eds_publish_slot *entry;
+    uint32_t sequence;
+
+    if (slot >= EDS_PUBLISH_SLOTS)
+        return 0;
+
+    entry = &subscriber->region->slot[slot];
+
+    for (;;) {
+        if (!(sequence = eds_subscriber_sequence(subscriber, slot)))
+            return 0;
+
+        memcpy(publication, &entry->publication, sizeof(*publication));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (__atomic_load_n(&entry->sequence, __ATOMIC_RELAXED) == sequence)
+            return sequence;
+    }
+}
+
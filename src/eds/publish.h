@@ -0,0 +1,121 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_publish_h
+#define eds_publish_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "info.h"
+
+#define EDS_PUBLISH_DEFAULT_NAME                "/eds"
+#define EDS_PUBLISH_SLOTS                       (0x20)
+#define EDS_PUBLISH_EDID_MAX                    (EDID_BLOCK_SIZE * 8)
+#define EDS_PUBLISH_SPINS                       (0x100000)
+
+/*!
+ * The state of one connector as published.  At most EDS_PUBLISH_EDID_MAX
+ * bytes of the EDID are kept; truncated is set if it was longer (info is
+ * always decoded from the complete EDID).
+ */
+struct eds_publication {
+    char             connector[64];
+    bool             connected;
+    bool             valid;                     /* info holds a decoded EDID */
+    bool             truncated;
+    uint16_t         length;
+    uint8_t          edid[EDS_PUBLISH_EDID_MAX];
+    struct edid_info info;
+};
+
+/*!
+ * A POSIX shared memory region of EDS_PUBLISH_SLOTS connector slots.  Each
+ * slot is guarded by a sequence lock: the (single) publisher never waits for
+ * readers, and readers neither block nor enter the kernel, retrying their copy
+ * if it raced with an update.
+ */
+struct eds_publisher;
+struct eds_subscriber;
+
+/*!
+ * Create (or take over) the region \p name, "/eds" if NULL.  A slot left mid
+ * update by a publisher which died is cleared so that readers do not wait on
+ * it.
+ */
+struct eds_publisher *
+eds_publisher_new(const char *name);
+
+/*! unmap and unlink the region; existing subscribers keep their mapping */
+void
+eds_publisher_free(struct eds_publisher *publisher);
+
+/*!
+ * Publish \p connector in \p slot.  \p data is the connector's EDID, NULL if
+ * it is disconnected.  \p info is decoded from \p data unless given.  Returns
+ * false if \p slot is out of range.
+ */
+bool
+eds_publisher_update(struct eds_publisher *publisher, size_t slot,
+                     const char *connector, const uint8_t *data,
+                     size_t length, const struct edid_info *info);
+
+/*! publish an empty, disconnected \p slot */
+void
+eds_publisher_clear(struct eds_publisher *publisher, size_t slot);
+
+/*! map the region \p name, "/eds" if NULL, for reading */
+struct eds_subscriber *
+eds_subscriber_new(const char *name);
+
+void
+eds_subscriber_free(struct eds_subscriber *subscriber);
+
+/*!
+ * The sequence number of \p slot.  It is even and changes with every update,
+ * so a reader can poll for changes without copying the slot.  Returns 0 if
+ * \p slot stays mid update for EDS_PUBLISH_SPINS retries, as when its
+ * publisher died while writing it.
+ */
+uint32_t
+eds_subscriber_sequence(const struct eds_subscriber *subscriber, size_t slot);
+
+/*!
+ * Copy a consistent snapshot of \p slot into \p publication.  Returns the
+ * slot's sequence number, or 0 if \p slot is out of range, has never been
+ * published or is stuck mid update (see eds_subscriber_sequence).
+ */
+uint32_t
+eds_subscriber_read(const struct eds_subscriber *subscriber, size_t slot,
+                    struct eds_publication *publication);
+
+#endif
+
@@ -0,0 +1,731 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "edid.h"
+#include "cea861.h"
+#include "hdmi.h"
+#include "dtd.h"
+#include "query.h"
+
+enum query_group {
+    QUERY_GROUP_BASE,
+    QUERY_GROUP_RANGE,
+    QUERY_GROUP_CEA,
+};
+
+/* name, group, set */
+#define QUERY_FIELDS(X)                                                         \
+    X(manufacturer,     BASE,  false)                                           \
+    X(product,          BASE,  false)                                           \
+    X(serial,           BASE,  false)                                           \
+    X(week,             BASE,  false)                                           \
+    X(year,             BASE,  false)                                           \
+    X(version,          BASE,  false)                                           \
+    X(revision,         BASE,  false)                                           \
+    X(extensions,       BASE,  false)                                           \
+    X(digital,          BASE,  false)                                           \
+    X(width,            BASE,  false)   /* cm */                                \
+    X(height,           BASE,  false)   /* cm */                                \
+    X(gamma,            BASE,  false)   /* x 100 */                             \
+    X(range,            RANGE, false)                                           \
+    X(min_vfreq,        RANGE, false)   /* Hz */                                \
+    X(max_vfreq,        RANGE, false)   /* Hz */                                \
+    X(min_hfreq,        RANGE, false)   /* kHz */                               \
+    X(max_hfreq,        RANGE, false)   /* kHz */                               \
+    X(max_pixel_clock,  RANGE, false)   /* MHz */                               \
+    X(cea,              CEA,   false)                                           \
+    X(cea_revision,     CEA,   false)                                           \
+    X(underscan,        CEA,   false)                                           \
+    X(basic_audio,      CEA,   false)                                           \
+    X(yuv444,           CEA,   false)                                           \
+    X(yuv422,           CEA,   false)                                           \
+    X(native_dtds,      CEA,   false)                                           \
+    X(vic,              CEA,   true)                                            \
+    X(audio_format,     CEA,   true)                                            \
+    X(audio_channels,   CEA,   true)                                            \
+    X(hdmi,             CEA,   false)                                           \
+    X(physical_address, CEA,   false)                                           \
+    X(max_tmds_clock,   CEA,   false)   /* MHz */                               \
+    X(dual_link,        CEA,   false)                                           \
+    X(dc30,             CEA,   false)                                           \
+    X(dc36,             CEA,   false)                                           \
+    X(dc48,             CEA,   false)                                           \
+    X(hdmi_yuv444,      CEA,   false)                                           \
+    X(ai,               CEA,   false)
+
+enum query_field {
+#define QUERY_FIELD_ENUM(name, group, set) QUERY_FIELD_##name,
+    QUERY_FIELDS(QUERY_FIELD_ENUM)
+#undef QUERY_FIELD_ENUM
+    QUERY_FIELD_COUNT,
+};
+
+static const struct query_field_info {
+    const char *name;
+    uint8_t    group;
+    bool       set;
+} query_fields[] = {
+#define QUERY_FIELD_ENTRY(name, group, set) { #name, QUERY_GROUP_##group, set },
+    QUERY_FIELDS(QUERY_FIELD_ENTRY)
+#undef QUERY_FIELD_ENTRY
+};
+
+static const char * const query_field_names[] = {
+#define QUERY_FIELD_NAME(name, group, set) #name,
+    QUERY_FIELDS(QUERY_FIELD_NAME)
+#undef QUERY_FIELD_NAME
+    NULL,
+};
+
+enum query_compare {
+    QUERY_COMPARE_EQ,
+    QUERY_COMPARE_NE,
+    QUERY_COMPARE_LT,
+    QUERY_COMPARE_LE,
+    QUERY_COMPARE_GT,
+    QUERY_COMPARE_GE,
+};
+
+/*
+ * A single accumulator machine: TEST sets it, NOT inverts it, and the jumps
+ * implement && and || by skipping the right hand side with the accumulator
+ * already holding the result.
+ */
+enum query_op {
+    QUERY_OP_TEST,
+    QUERY_OP_NOT,
+    QUERY_OP_JUMP_FALSE,
+    QUERY_OP_JUMP_TRUE,
+};
+
+struct instruction {
+    uint8_t  op;
+    uint8_t  field;
+    uint8_t  compare;
+    uint32_t value;                             /* or jump target */
+};
+
+struct eds_query {
+    size_t             count;
+    size_t             capacity;
+    struct instruction *code;
+};
+
+/* the fields of an EDID, decoded a group at a time */
+struct query_state {
+    const uint8_t          *data;
+    size_t                 length;
+    uint8_t                decoded;             /* 1 << enum query_group */
+
+    bool                   range;
+    struct edid_dtd_limits limits;
+
+    bool                   cea;
+    uint8_t                cea_revision;
+    uint8_t                cea_flags;           /* byte 3 of the first block */
+    uint64_t               vics[4];
+    uint64_t               audio_formats;
+    uint64_t               audio_channels;
+
+    bool                   hdmi;
+    uint16_t               physical_address;
+    uint16_t               max_tmds_clock;
+    uint8_t                hdmi_flags;
+};
+
+static void
+_query_svd(void * const context, const uint8_t block,
+           const struct cea861_short_video_descriptor * const svd)
+{
+    struct query_state * const state = context;
+    const uint8_t vic = cea861_short_video_descriptor_vic(svd);
+
+    (void) block;
+
+    if (vic)
+        state->vics[vic >> 6] |= UINT64_C(1) << (vic & 0x3f);
+}
+
+static void
+_query_sad(void * const context, const uint8_t block,
+           const struct cea861_short_audio_descriptor * const sad)
+{
+    struct query_state * const state = context;
+    const uint8_t * const data = (const uint8_t *) sad;
+
+    (void) block;
+
+    state->audio_formats |=
+        UINT64_C(1) << cea861_short_audio_descriptor_get_audio_format(data);
+    state->audio_channels |=
+        UINT64_C(1) << (cea861_short_audio_descriptor_get_channels(data) + 1);
+}
+
+static void
+_query_vsdb(void * const context, const uint8_t block,
+            const struct cea861_vendor_specific_data_block * const vsdb)
+{
+    struct query_state * const state = context;
+    const uint8_t * const data = (const uint8_t *) vsdb;
+    const uint8_t length = cea861_data_block_get_length(data);
+    const uint8_t * const oui = vsdb->ieee_registration;
+
+    (void) block;
+
+    if (state->hdmi || length < 5 || oui[2] != HDMI_OUI[0] ||
+        oui[1] != HDMI_OUI[1] || oui[0] != HDMI_OUI[2])
+        return;
+
+    state->hdmi = true;
+    state->physical_address =
+        hdmi_vendor_specific_data_block_get_physical_address(data);
+    if (length >= HDMI_VSDB_EXTENSION_FLAGS_OFFSET)
+        state->hdmi_flags = data[HDMI_VSDB_EXTENSION_FLAGS_OFFSET];
+    if (length >= HDMI_VSDB_MAX_TMDS_OFFSET)
+        state->max_tmds_clock =
+            hdmi_vendor_specific_data_block_get_max_tmds_clock(data) * 5;
+}
+
+static const struct edid_visitor _query_visitor = {
+    .short_video_descriptor = _query_svd,
+    .short_audio_descriptor = _query_sad,
+    .vendor_specific        = _query_vsdb,
+};
+
+static void
+_decode(struct query_state * const state, const enum query_group group)
+{
+    size_t count;
+
+    state->decoded |= 1 << group;
+
+    switch (group) {
+    case QUERY_GROUP_BASE:
+        break;
+    case QUERY_GROUP_RANGE:
+        state->range = edid_dtd_limits_decode(&state->limits, state->data,
+                                              state->length);
+        break;
+    case QUERY_GROUP_CEA:
+        count = state->length / EDID_BLOCK_SIZE;
+        if (count > (size_t) edid_get_extensions(state->data) + 1)
+            count = edid_get_extensions(state->data) + 1;
+
+        for (size_t i = 1; i < count; i++) {
+            const uint8_t * const block = state->data + i * EDID_BLOCK_SIZE;
+
+            if (block[0] != EDID_EXTENSION_CEA)
+                continue;
+
+            state->cea = true;
+            state->cea_revision = cea861_timing_block_get_revision(block);
+            state->cea_flags = block[3];
+            break;
+        }
+
+        if (state->cea)
+            edid_visit(state->data, state->length, &_query_visitor, state, NULL);
+        break;
+    }
+}
+
+static uint32_t
+_scalar(const struct query_state * const state, const enum query_field field)
+{
+    const uint8_t * const data = state->data;
+
+    switch (field) {
+    case QUERY_FIELD_manufacturer:
+        return edid_get_manufacturer(data) & 0x7fff;
+    case QUERY_FIELD_product:
+        return edid_get_product(data);
+    case QUERY_FIELD_serial:
+        return edid_get_serial_number(data);
+    case QUERY_FIELD_week:
+        return edid_get_manufacture_week(data);
+    case QUERY_FIELD_year:
+        return edid_get_manufacture_year(data) + 1990;
+    case QUERY_FIELD_version:
+        return edid_get_version(data);
+    case QUERY_FIELD_revision:
+        return edid_get_revision(data);
+    case QUERY_FIELD_extensions:
+        return edid_get_extensions(data);
+    case QUERY_FIELD_digital:
+        return edid_get_digital(data);
+    case QUERY_FIELD_width:
+        return edid_get_maximum_horizontal_image_size(data);
+    case QUERY_FIELD_height:
+        return edid_get_maximum_vertical_image_size(data);
+    case QUERY_FIELD_gamma:
+        return edid_get_display_transfer_characteristics(data) == 0xff ? 0 :
+               edid_get_display_transfer_characteristics(data) + 100;
+
+    case QUERY_FIELD_range:
+        return state->range;
+    case QUERY_FIELD_min_vfreq:
+        return state->range ? state->limits.min_vfreq / 1000 : 0;
+    case QUERY_FIELD_max_vfreq:
+        return state->range ? state->limits.max_vfreq / 1000 : 0;
+    case QUERY_FIELD_min_hfreq:
+        return state->range ? state->limits.min_hfreq / 1000 : 0;
+    case QUERY_FIELD_max_hfreq:
+        return state->range ? state->limits.max_hfreq / 1000 : 0;
+    case QUERY_FIELD_max_pixel_clock:
+        return state->range ? state->limits.max_pixel_clock / 1000 : 0;
+
+    case QUERY_FIELD_cea:
+        return state->cea;
+    case QUERY_FIELD_cea_revision:
+        return state->cea_revision;
+    case QUERY_FIELD_underscan:
+        return (state->cea_flags >> 7) & 1;
+    case QUERY_FIELD_basic_audio:
+        return (state->cea_flags >> 6) & 1;
+    case QUERY_FIELD_yuv444:
+        return (state->cea_flags >> 5) & 1;
+    case QUERY_FIELD_yuv422:
+        return (state->cea_flags >> 4) & 1;
+    case QUERY_FIELD_native_dtds:
+        return state->cea_flags & 0xf;
+
+    case QUERY_FIELD_hdmi:
+        return state->hdmi;
+    case QUERY_FIELD_physical_address:
+        return state->physical_address;
+    case QUERY_FIELD_max_tmds_clock:
+        return state->max_tmds_clock;
+    case QUERY_FIELD_dual_link:
+        return (state->hdmi_flags >> 0) & 1;
+    case QUERY_FIELD_hdmi_yuv444:
+        return (state->hdmi_flags >> 3) & 1;
+    case QUERY_FIELD_dc30:
+        return (state->hdmi_flags >> 4) & 1;
+    case QUERY_FIELD_dc36:
+        return (state->hdmi_flags >> 5) & 1;
+    case QUERY_FIELD_dc48:
+        return (state->hdmi_flags >> 6) & 1;
+    case QUERY_FIELD_ai:
+        return (state->hdmi_flags >> 7) & 1;
+
+    default:
+        return 0;
+    }
+}
+
+static inline bool
+_compare(const uint32_t lhs, const enum query_compare compare,
+         const uint32_t rhs)
+{
+    switch (compare) {
+    case QUERY_COMPARE_EQ: return lhs == rhs;
+    case QUERY_COMPARE_NE: return lhs != rhs;
+    case QUERY_COMPARE_LT: return lhs < rhs;
+    case QUERY_COMPARE_LE: return lhs <= rhs;
+    case QUERY_COMPARE_GT: return lhs > rhs;
+    case QUERY_COMPARE_GE: return lhs >= rhs;
+    }
+    return false;
+}
+
+static bool
+_test(struct query_state * const state,
+      const struct instruction * const instruction)
+{
+    const enum query_field field = instruction->field;
+    const uint64_t *members;
+    size_t words = 1;
+
+    if (!(state->decoded & (1 << query_fields[field].group)))
+        _decode(state, query_fields[field].group);
+
+    if (!query_fields[field].set)
+        return _compare(_scalar(state, field), instruction->compare,
+                        instruction->value);
+
+    switch (field) {
+    case QUERY_FIELD_vic:
+        members = state->vics;
+        words = ARRAY_SIZE(state->vics);
+        break;
+    case QUERY_FIELD_audio_format:
+        members = &state->audio_formats;
+        break;
+    case QUERY_FIELD_audio_channels:
+        members = &state->audio_channels;
+        break;
+    default:
+        return false;
+    }
+
+    for (size_t word = 0; word < words; word++) {
+        for (uint64_t bits = members[word]; bits; bits &= bits - 1) {
+            const uint32_t member = word * 64 + __builtin_ctzll(bits);
+
+            if (_compare(member, instruction->compare, instruction->value))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+bool
+eds_query_match(const struct eds_query * const query,
+                const uint8_t * const data, const size_t length)
+{
+    struct query_state state;
+    bool accumulator = false;
+    size_t pc = 0;
+
+    if (length < EDID_BLOCK_SIZE || memcmp(data, EDID_HEADER, sizeof(EDID_HEADER)))
+        return false;
+
+    memset(&state, 0, sizeof(state));
+    state.data = data;
+    state.length = length;
+
+    while (pc < query->count) {
+        const struct instruction * const instruction = &query->code[pc];
+
+        switch (instruction->op) {
+        case QUERY_OP_TEST:
+            accumulator = _test(&state, instruction);
+            pc++;
+            break;
+        case QUERY_OP_NOT:
+            accumulator = !accumulator;
+            pc++;
+            break;
+        case QUERY_OP_JUMP_FALSE:
+            pc = accumulator ? pc + 1 : instruction->value;
+            break;
+        case QUERY_OP_JUMP_TRUE:
+            pc = accumulator ? instruction->value : pc + 1;
+            break;
+        }
+    }
+
+    return accumulator;
+}
+
+/* compilation */
+
+struct parser {
+    const char       *input;
+    const char       *cursor;
+    struct eds_query *query;
+    char             *error;
+    size_t           size;
+    bool             failed;
+};
+
+static void
+_fail(struct parser * const parser, const char * const message)
+{
+    if (parser->failed)
+        return;
+
+    parser->failed = true;
+    if (parser->error && parser->size)
+        snprintf(parser->error, parser->size, "offset %td: %s",
+                 parser->cursor - parser->input, message);
+}
+
+static size_t
+_emit(struct parser * const parser, const uint8_t op, const uint8_t field,
+      const uint8_t compare, const uint32_t value)
+{
+    struct eds_query * const query = parser->query;
+
+    if (query->count == query->capacity) {
+        const size_t capacity = query->capacity ? query->capacity << 1 : 16;
+        struct instruction * const code =
+            realloc(query->code, capacity * sizeof(*code));
+
+        if (!code) {
+            _fail(parser, "out of memory");
+            return 0;
+        }
+
+        query->code = code;
+        query->capacity = capacity;
+    }
+
+    query->code[query->count].op = op;
+    query->code[query->count].field = field;
+    query->code[query->count].compare = compare;
+    query->code[query->count].value = value;
+    return query->count++;
+}
+
+static void
+_skip(struct parser * const parser)
+{
+    while (isspace((unsigned char) *parser->cursor))
+        parser->cursor++;
+}
+
+/* consume \p token; words only match whole identifiers */
+static bool
+_accept(struct parser * const parser, const char * const token)
+{
+    const size_t length = strlen(token);
+
+    _skip(parser);
+
+    if (strncmp(parser->cursor, token, length))
+        return false;
+
+    if (isalpha((unsigned char) token[0]) &&
+        (isalnum((unsigned char) parser->cursor[length]) ||
+         parser->cursor[length] == '_'))
+        return false;
+
+    parser->cursor += length;
+    return true;
+}
+
+static size_t
+_identifier(struct parser * const parser, const char ** const start)
+{
+    size_t length = 0;
+
+    _skip(parser);
+    *start = parser->cursor;
+
+    if (!isalpha((unsigned char) **start))
+        return 0;
+
+    while (isalnum((unsigned char) (*start)[length]) || (*start)[length] == '_')
+        length++;
+
+    return length;
+}
+
+static bool
+_literal(struct parser * const parser, uint32_t * const value)
+{
+    const char *start;
+    size_t length;
+    char *end;
+
+    _skip(parser);
+
+    /* a PNP ID */
+    length = _identifier(parser, &start);
+    if (length) {
+        if (length != 3 || !isupper((unsigned char) start[0]) ||
+            !isupper((unsigned char) start[1]) || !isupper((unsigned char) start[2]))
+            return false;
+
+        *value = ((start[0] - '@') << 10) | ((start[1] - '@') << 5) | (start[2] - '@');
+        parser->cursor += length;
+        return true;
+    }
+
+    if (!isdigit((unsigned char) *parser->cursor))
+        return false;
+
+    *value = strtoul(parser->cursor, &end, 0);
+
+    /* a physical address */
+    if (*end == '.') {
+        uint8_t nibbles = 1;
+
+        if (*value > 0xf)
+            return false;
+
+        while (*end == '.' && nibbles < 4) {
+            const unsigned long nibble = strtoul(end + 1, &end, 10);
+
+            if (nibble > 0xf)
+                return false;
+            *value = (*value << 4) | nibble;
+            nibbles++;
+        }
+
+        if (nibbles != 4)
+            return false;
+    }
+
+    parser->cursor = end;
+    return true;
+}
+
+static void _or(struct parser *parser);
+
+static void
+_test_expression(struct parser * const parser)
+{
+    static const struct {
+        const char *token;
+        uint8_t    compare;
+    } operators[] = {
+        { "==", QUERY_COMPARE_EQ },
+        { "!=", QUERY_COMPARE_NE },
+        { "<=", QUERY_COMPARE_LE },
+        { ">=", QUERY_COMPARE_GE },
+        { "<",  QUERY_COMPARE_LT },
+        { ">",  QUERY_COMPARE_GT },
+    };
+    const char *name;
+    const size_t length = _identifier(parser, &name);
+    uint32_t value = 0;
+    uint8_t field, compare = QUERY_COMPARE_NE;
+
+    if (!length) {
+        _fail(parser, "expected a field");
+        return;
+    }
+
+    for (field = 0; field < QUERY_FIELD_COUNT; field++)
+        if (strlen(query_fields[field].name) == length &&
+            !strncmp(query_fields[field].name, name, length))
+            break;
+
+    if (field == QUERY_FIELD_COUNT) {
+        _fail(parser, "unknown field");
+        return;
+    }
+    parser->cursor += length;
+
+    for (size_t i = 0; i < ARRAY_SIZE(operators); i++) {
+        if (_accept(parser, operators[i].token)) {
+            compare = operators[i].compare;
+            if (!_literal(parser, &value)) {
+                _fail(parser, "expected a number");
+                return;
+            }
+            break;
+        }
+    }
+
+    _emit(parser, QUERY_OP_TEST, field, compare, value);
+}
+
+static void
+_not(struct parser * const parser)
+{
+    if (_accept(parser, "!") || _accept(parser, "not")) {
+        _not(parser);
+        _emit(parser, QUERY_OP_NOT, 0, 0, 0);
+        return;
+    }
+
+    if (_accept(parser, "(")) {
+        _or(parser);
+        if (!_accept(parser, ")"))
+            _fail(parser, "expected ')'");
+        return;
+    }
+
+    _test_expression(parser);
+}
+
+static void
+_and(struct parser * const parser)
+{
+    _not(parser);
+
+    while (!parser->failed && (_accept(parser, "&&") || _accept(parser, "and"))) {
+        const size_t jump = _emit(parser, QUERY_OP_JUMP_FALSE, 0, 0, 0);
+
+        _not(parser);
+        if (!parser->failed)
+            parser->query->code[jump].value = parser->query->count;
+    }
+}
+
+static void
+_or(struct parser * const parser)
+{
+    _and(parser);
+
+    while (!parser->failed && (_accept(parser, "||") || _accept(parser, "or"))) {
+        const size_t jump = _emit(parser, QUERY_OP_JUMP_TRUE, 0, 0, 0);
+
+        _and(parser);
+        if (!parser->failed)
+            parser->query->code[jump].value = parser->query->count;
+    }
+}
+
+struct eds_query *
+eds_query_compile(const char * const expression, char * const error,
+                  const size_t size)
+{
+    struct parser parser = {
+        .input  = expression,
+        .cursor = expression,
+        .error  = error,
+        .size   = size,
+    };
+
+    if (!(parser.query = calloc(1, sizeof(*parser.query)))) {
+        _fail(&parser, "out of memory");
+        return NULL;
+    }
+
+    _or(&parser);
+
+    _skip(&parser);
+    if (*parser.cursor)
+        _fail(&parser, "unexpected input");
+
+    if (parser.failed) {
+        eds_query_free(parser.query);
+        return NULL;
+    }
+
+    return parser.query;
+}
+
+void
+eds_query_free(struct eds_query * const query)
+{
+    if (!query)
+        return;
+
+    free(query->code);
+    free(query);
+}
+
+const char * const *
+eds_query_fields(void)
+{
+    return query_field_names;
+}
+
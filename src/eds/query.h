@@ -0,0 +1,77 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_query_h
+#define eds_query_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ * Predicates over decoded EDIDs, e.g.
+ *
+ *   vic == 97 && max_tmds_clock >= 340 && !yuv444
+ *
+ * A predicate combines tests with &&, || and ! (or and, or, not) and
+ * parentheses.  A test is a field compared (==, !=, <, <=, >, >=) to a
+ * number, or a field on its own which holds if it is non-zero.  Numbers may
+ * be decimal or hexadecimal; a manufacturer may be given as its PNP ID (DEL)
+ * and a physical address in dotted form (1.0.0.0).  vic, audio_format and
+ * audio_channels are sets and hold if any member matches.
+ *
+ * Predicates compile to a short-circuiting bytecode.  Fields are grouped by
+ * what has to be decoded for them (nothing for the base block, the range
+ * limits descriptor, or a walk of the CEA-861 extensions) and a group is only
+ * decoded when the evaluation first reaches one of its fields.
+ */
+struct eds_query;
+
+/*!
+ * Compile \p expression.  On failure NULL is returned and, if \p error is
+ * given, a message naming the offending offset is written to it.
+ */
+struct eds_query *
+eds_query_compile(const char *expression, char *error, size_t size);
+
+void
+eds_query_free(struct eds_query *query);
+
+/*! evaluate \p query against the EDID in \p data; safe to call concurrently */
+bool
+eds_query_match(const struct eds_query *query, const uint8_t *data,
+                size_t length);
+
+/*! the names of the fields known to the query language, NULL terminated */
+const char * const *
+eds_query_fields(void);
+
+#endif
+
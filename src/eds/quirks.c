@@ -0,0 +1,179 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include "edid.h"
+#include "quirks.h"
+
+struct edid_quirk_slot {
+    uint32_t key;
+    uint16_t index;
+    uint16_t count;
+};
+
+#include "quirks-table.h"
+
+/* the slot of \p manufacturer and \p product, NULL if there is no quirk */
+static const struct edid_quirk_slot *
+_probe(const uint16_t manufacturer, const uint16_t product)
+{
+    const uint32_t key = ((uint32_t) manufacturer << 16) | product;
+    const struct edid_quirk_slot * const slot =
+        &edid_quirk_slots[EDID_QUIRK_HASH(key)];
+
+    if (slot->key != key || !slot->count)
+        return NULL;
+    return slot;
+}
+
+static const struct edid_quirk *
+_select(const struct edid_quirk_slot * const slot, const uint64_t fingerprint)
+{
+    for (uint16_t i = 0; i < slot->count; i++) {
+        const struct edid_quirk * const quirk = &edid_quirk_entries[slot->index + i];
+
+        if (!quirk->fingerprint || quirk->fingerprint == fingerprint)
+            return quirk;
+    }
+
+    return NULL;
+}
+
+const struct edid_quirk *
+edid_quirk_lookup(const uint16_t manufacturer, const uint16_t product,
+                  const uint64_t fingerprint)
+{
+    const struct edid_quirk_slot * const slot = _probe(manufacturer, product);
+
+    return slot ? _select(slot, fingerprint) : NULL;
+}
+
+const struct edid_quirk *
+edid_quirk_find(const uint8_t * const edid)
+{
+    const struct edid_quirk_slot * const slot =
+        _probe(edid_get_manufacturer(edid), edid_get_product(edid));
+
+    if (!slot)
+        return NULL;
+
+    /* fingerprinted entries sort first; only hash the block if there are any */
+    return _select(slot, edid_quirk_entries[slot->index].fingerprint
+                             ? edid_model_fingerprint(edid) : 0);
+}
+
+static void
+_prefer(struct edid_info * const info, const struct edid_mode * const mode)
+{
+    for (uint8_t i = 0; i < info->modes; i++)
+        info->mode[i].preferred = &info->mode[i] == mode;
+}
+
+static void
+_prefer_large(struct edid_info * const info, const uint32_t refresh)
+{
+    const struct edid_mode *best = NULL;
+    uint32_t best_area = 0, best_delta = 0;
+
+    for (uint8_t i = 0; i < info->modes; i++) {
+        const struct edid_mode * const mode = &info->mode[i];
+        const uint32_t area = mode->hactive * mode->vactive;
+        const uint32_t delta = mode->refresh > refresh ? mode->refresh - refresh
+                                                       : refresh - mode->refresh;
+
+        if (!best || area > best_area || (area == best_area && delta < best_delta)) {
+            best = mode;
+            best_area = area;
+            best_delta = delta;
+        }
+    }
+
+    if (best)
+        _prefer(info, best);
+}
+
+void
+edid_quirk_apply(const struct edid_quirk * const quirk,
+                 struct edid_info * const info)
+{
+    if (!quirk)
+        return;
+
+    info->quirks |= quirk->flags;
+
+    if (quirk->flags & EDID_QUIRK_FIRST_DETAILED_PREFERRED) {
+        for (uint8_t i = 0; i < info->modes; i++) {
+            if (info->mode[i].source == EDID_MODE_SOURCE_DETAILED_TIMING) {
+                _prefer(info, &info->mode[i]);
+                break;
+            }
+        }
+    }
+
+    if (quirk->flags & EDID_QUIRK_PREFER_LARGE_60)
+        _prefer_large(info, 60000);
+    if (quirk->flags & EDID_QUIRK_PREFER_LARGE_75)
+        _prefer_large(info, 75000);
+
+    if (quirk->flags & EDID_QUIRK_NO_AUDIO)
+        info->basic_audio = false;
+
+    if (quirk->flags & EDID_QUIRK_MAX_TMDS_CLOCK)
+        info->max_tmds_clock = quirk->max_tmds_clock;
+
+    if (quirk->flags & EDID_QUIRK_PREFERRED_MODE) {
+        struct edid_mode *mode = NULL;
+
+        for (uint8_t i = 0; i < info->modes; i++) {
+            const struct edid_mode * const candidate = &info->mode[i];
+
+            if (candidate->hactive == quirk->hactive &&
+                candidate->vactive == quirk->vactive &&
+                (candidate->refresh + 500) / 1000 == quirk->refresh) {
+                mode = &info->mode[i];
+                break;
+            }
+        }
+
+        if (!mode && info->modes < ARRAY_SIZE(info->mode)) {
+            mode = &info->mode[info->modes++];
+            *mode = (struct edid_mode) {
+                .hactive = quirk->hactive,
+                .vactive = quirk->vactive,
+                .refresh = quirk->refresh * 1000,
+                .source = EDID_MODE_SOURCE_STANDARD_TIMING,
+            };
+        }
+
+        if (mode)
+            _prefer(info, mode);
+    }
+}
@@ -0,0 +1,79 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_quirks_h
+#define eds_quirks_h
+
+#include <stdint.h>
+
+#include "info.h"
+
+enum edid_quirk_flags {
+    EDID_QUIRK_FIRST_DETAILED_PREFERRED = (1 << 0),
+    EDID_QUIRK_PREFER_LARGE_60          = (1 << 1),
+    EDID_QUIRK_PREFER_LARGE_75          = (1 << 2),
+    EDID_QUIRK_NO_AUDIO                 = (1 << 3),
+    EDID_QUIRK_MAX_TMDS_CLOCK           = (1 << 4),
+    EDID_QUIRK_PREFERRED_MODE           = (1 << 5),
+};
+
+struct edid_quirk {
+    uint32_t flags;                             /* enum edid_quirk_flags */
+    uint64_t fingerprint;                       /* 0 matches any model */
+
+    uint16_t max_tmds_clock;                    /* MHz */
+
+    /* preferred mode override */
+    uint16_t hactive;
+    uint16_t vactive;
+    uint16_t refresh;                           /* Hz */
+};
+
+/*!
+ * Look up the quirk for the display identified by the big endian PNP ID
+ * \p manufacturer and the \p product code.  The database is generated at build
+ * time into a perfect hash so a lookup is a single probe.  Entries which are
+ * qualified by a model fingerprint only match that fingerprint.
+ */
+const struct edid_quirk *
+edid_quirk_lookup(uint16_t manufacturer, uint16_t product, uint64_t fingerprint);
+
+/*!
+ * Look up the quirk for the base block \p edid.  The model fingerprint is only
+ * computed if an entry for the product is qualified by one.
+ */
+const struct edid_quirk *
+edid_quirk_find(const uint8_t *edid);
+
+/*! apply \p quirk as an override of the decoded \p info */
+void
+edid_quirk_apply(const struct edid_quirk *quirk, struct edid_info *info);
+
+#endif
@@ -0,0 +1,517 @@
+/* vim: set et fde fdm=syntax ft=cpp.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_ranges_hpp
+#define eds_ranges_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+#include "edid.hpp"
+
+/*!
+ * Lazy views over the structures of an EDID.  The views hold pointers into the
+ * caller's buffer, never allocate, and stop at the end of the enclosing block
+ * or data block, so a malformed length cannot walk out of bounds.  Elements
+ * are small handles whose accessors are generated from fields.def:
+ *
+ *  for (auto svd : eds::data_blocks(block)
+ *                | std::views::transform(eds::short_video_descriptors)
+ *                | std::views::join
+ *                | std::views::filter(&eds::short_video_descriptor::native))
+ *      ...
+ */
+
+namespace eds {
+
+struct standard_timing {
+    const std::uint8_t *data = nullptr;
+
+    constexpr std::uint16_t
+    hactive() const
+    {
+        return detail::standard_timing_hactive(data);
+    }
+
+    constexpr std::uint16_t
+    vactive() const
+    {
+        return detail::standard_timing_vactive(data);
+    }
+
+    constexpr std::uint8_t
+    refresh() const
+    {
+        return edid_standard_timing_get_refresh_rate(data) + 60;
+    }
+
+    /* unused slots are filled with 0x01 0x01 */
+    static constexpr bool
+    present(const std::uint8_t *data)
+    {
+        return !(data[0] == 0x01 && data[1] == 0x01);
+    }
+};
+
+struct detailed_timing {
+    const std::uint8_t *data = nullptr;
+
+    constexpr std::uint32_t
+    pixel_clock() const                         /* kHz */
+    {
+        return edid_detailed_timing_get_pixel_clock(data) * 10;
+    }
+
+    constexpr std::uint16_t
+    hactive() const
+    {
+        return edid_detailed_timing_get_horizontal_active(data);
+    }
+
+    constexpr std::uint16_t
+    vactive() const
+    {
+        return edid_detailed_timing_get_vertical_active(data);
+    }
+
+    constexpr std::uint16_t
+    hblank() const
+    {
+        return edid_detailed_timing_get_horizontal_blanking(data);
+    }
+
+    constexpr std::uint16_t
+    vblank() const
+    {
+        return edid_detailed_timing_get_vertical_blanking(data);
+    }
+
+    constexpr bool
+    interlaced() const
+    {
+        return edid_detailed_timing_get_interlaced(data);
+    }
+
+    /* a zero pixel clock marks a monitor descriptor or the end of the list */
+    static constexpr bool
+    present(const std::uint8_t *data)
+    {
+        return edid_detailed_timing_get_pixel_clock(data) != 0;
+    }
+};
+
+struct monitor_descriptor {
+    const std::uint8_t *data = nullptr;
+
+    constexpr std::uint8_t
+    tag() const
+    {
+        return edid_monitor_descriptor_get_tag(data);
+    }
+
+    constexpr std::span<const std::uint8_t, 13>
+    payload() const
+    {
+        return std::span<const std::uint8_t, 13>(data + 5, 13);
+    }
+
+    static constexpr bool
+    present(const std::uint8_t *data)
+    {
+        return !edid_monitor_descriptor_get_flag0(data) &&
+               !edid_monitor_descriptor_get_flag1(data) &&
+               !edid_monitor_descriptor_get_flag2(data);
+    }
+};
+
+struct short_video_descriptor {
+    const std::uint8_t *data = nullptr;
+
+    constexpr std::uint8_t
+    vic() const
+    {
+        return cea861_short_video_descriptor_vic(data);
+    }
+
+    constexpr bool
+    native() const
+    {
+        return cea861_short_video_descriptor_native(data);
+    }
+
+    constexpr const cea861_timing *
+    timing() const
+    {
+        return vic_lookup(vic());
+    }
+
+    static constexpr bool
+    present(const std::uint8_t *)
+    {
+        return true;
+    }
+};
+
+struct short_audio_descriptor {
+    const std::uint8_t *data = nullptr;
+
+    constexpr std::uint8_t
+    format() const
+    {
+        return cea861_short_audio_descriptor_get_audio_format(data);
+    }
+
+    constexpr std::uint8_t
+    channels() const
+    {
+        return cea861_short_audio_descriptor_get_channels(data) + 1;
+    }
+
+    constexpr std::uint8_t
+    sample_rates() const
+    {
+        return cea861_short_audio_descriptor_get_sample_rates(data);
+    }
+
+    constexpr std::uint8_t
+    flags() const
+    {
+        return cea861_short_audio_descriptor_get_flags(data);
+    }
+
+    static constexpr bool
+    present(const std::uint8_t *)
+    {
+        return true;
+    }
+};
+
+struct data_block {
+    const std::uint8_t *data = nullptr;
+
+    constexpr std::uint8_t
+    tag() const
+    {
+        return cea861_data_block_get_tag(data);
+    }
+
+    constexpr std::uint8_t
+    length() const
+    {
+        return cea861_data_block_get_length(data);
+    }
+
+    constexpr std::span<const std::uint8_t>
+    payload() const
+    {
+        return std::span<const std::uint8_t>(data + 1, length());
+    }
+};
+
+/*!
+ * Fixed size records of type T laid out Stride bytes apart in [begin, end).
+ * Records for which T::present is false are skipped or, with Terminate set,
+ * end the view as a null DTD ends the CEA-861 DTD list.
+ */
+template <typename T, std::size_t Stride, bool Terminate = false>
+class record_view
+    : public std::ranges::view_interface<record_view<T, Stride, Terminate>> {
+    const std::uint8_t *begin_ = nullptr;
+    const std::uint8_t *end_ = nullptr;
+
+    static constexpr const std::uint8_t *
+    settle(const std::uint8_t *record, const std::uint8_t *end)
+    {
+        if constexpr (!Terminate)
+            while (static_cast<std::size_t>(end - record) >= Stride &&
+                   !T::present(record))
+                record = record + Stride;
+        return record;
+    }
+
+public:
+    class iterator {
+        const std::uint8_t *record_ = nullptr;
+        const std::uint8_t *end_ = nullptr;
+
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        constexpr iterator() = default;
+        constexpr iterator(const std::uint8_t *record, const std::uint8_t *end)
+            : record_(settle(record, end)), end_(end) {}
+
+        constexpr T
+        operator*() const
+        {
+            return T{record_};
+        }
+
+        constexpr iterator &
+        operator++()
+        {
+            record_ = settle(record_ + Stride, end_);
+            return *this;
+        }
+
+        constexpr iterator
+        operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        constexpr bool
+        operator==(const iterator &other) const
+        {
+            return record_ == other.record_;
+        }
+
+        constexpr bool
+        operator==(std::default_sentinel_t) const
+        {
+            return static_cast<std::size_t>(end_ - record_) < Stride ||
+                   (Terminate && !T::present(record_));
+        }
+    };
+
+    constexpr record_view() = default;
+    constexpr record_view(const std::uint8_t *begin, const std::uint8_t *end)
+        : begin_(begin), end_(end) {}
+
+    constexpr iterator
+    begin() const
+    {
+        return iterator(begin_, end_);
+    }
+
+    constexpr std::default_sentinel_t
+    end() const
+    {
+        return std::default_sentinel;
+    }
+};
+
+/*! the data block collection of a CEA-861 extension */
+class data_block_view : public std::ranges::view_interface<data_block_view> {
+    const std::uint8_t *begin_ = nullptr;
+    const std::uint8_t *end_ = nullptr;
+
+public:
+    class iterator {
+        const std::uint8_t *block_ = nullptr;
+        const std::uint8_t *end_ = nullptr;
+
+    public:
+        using value_type = data_block;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        constexpr iterator() = default;
+        constexpr iterator(const std::uint8_t *block, const std::uint8_t *end)
+            : block_(block), end_(end) {}
+
+        constexpr data_block
+        operator*() const
+        {
+            return data_block{block_};
+        }
+
+        constexpr iterator &
+        operator++()
+        {
+            block_ = block_ + 1 + cea861_data_block_get_length(block_);
+            return *this;
+        }
+
+        constexpr iterator
+        operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        constexpr bool
+        operator==(const iterator &other) const
+        {
+            return block_ == other.block_;
+        }
+
+        /* a data block overrunning the collection ends it */
+        constexpr bool
+        operator==(std::default_sentinel_t) const
+        {
+            return block_ >= end_ ||
+                   1 + cea861_data_block_get_length(block_) > end_ - block_;
+        }
+    };
+
+    constexpr data_block_view() = default;
+    constexpr data_block_view(const std::uint8_t *begin, const std::uint8_t *end)
+        : begin_(begin), end_(end) {}
+
+    constexpr iterator
+    begin() const
+    {
+        return iterator(begin_, end_);
+    }
+
+    constexpr std::default_sentinel_t
+    end() const
+    {
+        return std::default_sentinel;
+    }
+};
+
+namespace detail {
+
+/* the DTD offset of a CEA-861 extension, or 0 if it is not one */
+constexpr std::uint8_t
+cea861_dtd_offset(std::span<const std::uint8_t> block)
+{
+    std::uint8_t dtd_offset;
+
+    if (block.size() < block_size || block[0] != 0x02)
+        return 0;
+
+    dtd_offset = cea861_timing_block_get_dtd_offset(block.data());
+    return dtd_offset >= 4 && dtd_offset < block_size - 1 ? dtd_offset : 0;
+}
+
+}
+
+/*! the blocks of an EDID, as far as both the buffer and the count reach */
+constexpr auto
+blocks(std::span<const std::uint8_t> edid)
+{
+    std::size_t count = edid.size() / block_size;
+
+    if (count && count > edid_get_extensions(edid.data()) + std::size_t{1})
+        count = edid_get_extensions(edid.data()) + std::size_t{1};
+
+    return std::views::iota(std::size_t{0}, count)
+         | std::views::transform([edid](std::size_t i) {
+               return edid.subspan(i * block_size, block_size);
+           });
+}
+
+/*! standard timings of the base block; unused slots are skipped */
+constexpr record_view<standard_timing, 2>
+standard_timings(std::span<const std::uint8_t> edid)
+{
+    if (edid.size() < block_size)
+        return {};
+    return { edid.data() + 0x26, edid.data() + 0x36 };
+}
+
+/*! detailed timings of the base block; monitor descriptors are skipped */
+constexpr record_view<detailed_timing, 18>
+detailed_timings(std::span<const std::uint8_t> edid)
+{
+    if (edid.size() < block_size)
+        return {};
+    return { edid.data() + 0x36, edid.data() + 0x7e };
+}
+
+/*! monitor descriptors of the base block */
+constexpr record_view<monitor_descriptor, 18>
+monitor_descriptors(std::span<const std::uint8_t> edid)
+{
+    if (edid.size() < block_size)
+        return {};
+    return { edid.data() + 0x36, edid.data() + 0x7e };
+}
+
+/*! detailed timings of a CEA-861 extension; empty for any other block */
+constexpr record_view<detailed_timing, 18, true>
+cea861_detailed_timings(std::span<const std::uint8_t> block)
+{
+    const std::uint8_t dtd_offset = detail::cea861_dtd_offset(block);
+
+    if (!dtd_offset)
+        return {};
+    return { block.data() + dtd_offset, block.data() + block_size - 1 };
+}
+
+/*! data blocks of a CEA-861 extension (revision 3 or later) */
+constexpr data_block_view
+data_blocks(std::span<const std::uint8_t> block)
+{
+    const std::uint8_t dtd_offset = detail::cea861_dtd_offset(block);
+
+    if (!dtd_offset || cea861_timing_block_get_revision(block.data()) < 3)
+        return {};
+    return { block.data() + 4, block.data() + dtd_offset };
+}
+
+/*! SVDs of a video data block; empty for any other data block */
+constexpr record_view<short_video_descriptor, 1>
+short_video_descriptors(data_block db)
+{
+    if (db.tag() != 2)
+        return {};
+    return { db.data + 1, db.data + 1 + db.length() };
+}
+
+/*! SADs of an audio data block; empty for any other data block */
+constexpr record_view<short_audio_descriptor, 3>
+short_audio_descriptors(data_block db)
+{
+    if (db.tag() != 1)
+        return {};
+    return { db.data + 1, db.data + 1 + db.length() };
+}
+
+/*! the modes collected by decode() */
+constexpr std::span<const mode>
+modes(const info &info)
+{
+    return std::span<const mode>(info.mode.data(), info.modes);
+}
+
+}
+
+template <typename T, std::size_t Stride, bool Terminate>
+inline constexpr bool
+std::ranges::enable_borrowed_range<eds::record_view<T, Stride, Terminate>> = true;
+
+template <>
+inline constexpr bool
+std::ranges::enable_borrowed_range<eds::data_block_view> = true;
+
+#endif
+
@@ -0,0 +1,333 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "registry.h"
+#include "dtd.h"
+#include "hdmi.h"
+
+#define EDS_REGISTRY_QUIESCENT                  (0)
+
+struct entry {
+    struct entry        *next;                  /* on the retired list */
+    uint64_t            epoch;                  /* at retirement */
+    struct eds_snapshot snapshot;
+};
+
+struct eds_registry_reader {
+    uint64_t                   epoch;           /* 0 outside of a section */
+    struct eds_registry        *registry;
+    struct eds_registry_reader *next;
+} __attribute__ (( aligned(64) ));
+
+struct eds_registry {
+    uint64_t                   epoch __attribute__ (( aligned(64) ));
+
+    pthread_mutex_t            lock __attribute__ (( aligned(64) ));
+    struct eds_registry_reader *readers;
+    struct entry               *retired;
+    uint64_t                   generation;
+
+    size_t                     connectors;
+    struct entry               **current;
+};
+
+struct eds_registry *
+eds_registry_new(const size_t connectors)
+{
+    struct eds_registry *registry;
+
+    if (posix_memalign((void **) &registry, 64, sizeof(*registry)))
+        return NULL;
+    memset(registry, 0, sizeof(*registry));
+
+    if (!(registry->current = calloc(connectors, sizeof(*registry->current)))) {
+        free(registry);
+        return NULL;
+    }
+
+    pthread_mutex_init(&registry->lock, NULL);
+    registry->epoch = EDS_REGISTRY_QUIESCENT + 1;
+    registry->connectors = connectors;
+
+    return registry;
+}
+
+void
+eds_registry_free(struct eds_registry * const registry)
+{
+    if (!registry)
+        return;
+
+    for (size_t i = 0; i < registry->connectors; i++)
+        free(registry->current[i]);
+
+    for (struct entry *entry = registry->retired, *next; entry; entry = next) {
+        next = entry->next;
+        free(entry);
+    }
+
+    pthread_mutex_destroy(&registry->lock);
+    free(registry->current);
+    free(registry);
+}
+
+static void
+_visit_vsdb(void * const context, const uint8_t block,
+            const struct cea861_vendor_specific_data_block * const vsdb)
+{
+    struct eds_snapshot * const snapshot = context;
+    const uint8_t * const data = (const uint8_t *) vsdb;
+    const uint8_t length = cea861_data_block_get_length(data);
+    const uint8_t * const oui = vsdb->ieee_registration;
+    uint16_t minimum, maximum;
+
+    (void) block;
+
+    if (length < HDMI_FORUM_VSDB_VRR_OFFSET || oui[2] != HDMI_FORUM_OUI[0] ||
+        oui[1] != HDMI_FORUM_OUI[1] || oui[0] != HDMI_FORUM_OUI[2])
+        return;
+
+    /* VRRmax is optional; 0 defers to the range limits */
+    minimum = hdmi_forum_vendor_specific_data_block_get_vrr_min(data);
+    maximum = hdmi_forum_vendor_specific_data_block_get_vrr_max(data);
+    if (minimum == 0)
+        return;
+
+    snapshot->vrr = true;
+    snapshot->min_vfreq = minimum * 1000;
+    if (maximum)
+        snapshot->max_vfreq = maximum * 1000;
+}
+
+static const struct edid_visitor _vrr_visitor = {
+    .vendor_specific = _visit_vsdb,
+};
+
+static void
+_decode_caps(struct eds_snapshot * const snapshot, const uint8_t * const data,
+             const size_t length)
+{
+    struct edid_dtd_limits limits;
+    struct edid_color color;
+
+    /* the eotfs and luminances do not depend upon a usable gamut */
+    (void) edid_color_decode(&color, data, length);
+    snapshot->eotfs = color.eotfs;
+    snapshot->max_luminance = color.max_luminance;
+    snapshot->max_frame_average_luminance = color.max_frame_average_luminance;
+    snapshot->min_luminance = color.min_luminance;
+
+    if (edid_dtd_limits_decode(&limits, data, length)) {
+        /* EDID 1.4 redefines the default GTF bit as continuous frequency */
+        snapshot->vrr = edid_get_revision(data) >= 4 && edid_get_default_gtf(data);
+        snapshot->min_vfreq = limits.min_vfreq;
+        snapshot->max_vfreq = limits.max_vfreq;
+    }
+
+    (void) edid_visit(data, length, &_vrr_visitor, snapshot, NULL);
+
+    if (!snapshot->vrr || snapshot->max_vfreq <= snapshot->min_vfreq) {
+        snapshot->vrr = false;
+        snapshot->min_vfreq = snapshot->max_vfreq = 0;
+    }
+}
+
+/* must be called with the lock held */
+static size_t
+_reclaim(struct eds_registry * const registry)
+{
+    uint64_t oldest = __atomic_load_n(&registry->epoch, __ATOMIC_RELAXED);
+    struct entry **link = &registry->retired;
+    size_t reclaimed = 0;
+
+    /* pairs with the fence in eds_registry_read_lock */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    for (const struct eds_registry_reader *reader = registry->readers; reader;
+         reader = reader->next) {
+        const uint64_t epoch = __atomic_load_n(&reader->epoch, __ATOMIC_ACQUIRE);
+
+        if (epoch != EDS_REGISTRY_QUIESCENT && epoch < oldest)
+            oldest = epoch;
+    }
+
+    /*
+     * A reader in epoch e may hold any snapshot retired in epoch e or later;
+     * everything retired before the oldest active epoch is unreachable.
+     */
+    while (*link) {
+        struct entry * const entry = *link;
+
+        if (entry->epoch < oldest) {
+            *link = entry->next;
+            free(entry);
+            reclaimed++;
+        } else {
+            link = &entry->next;
+        }
+    }
+
+    return reclaimed;
+}
+
+bool
+eds_registry_publish(struct eds_registry * const registry,
+                     const uint32_t connector, const uint8_t * const data,
+                     const size_t length)
+{
+    struct entry *entry = NULL, *previous;
+
+    if (connector >= registry->connectors)
+        return false;
+
+    /* the snapshot is built before it becomes visible and never changes */
+    if (data) {
+        if (!(entry = calloc(1, sizeof(*entry) + length)))
+            return false;
+
+        memcpy(entry + 1, data, length);
+        entry->snapshot.connector = connector;
+        entry->snapshot.length = length;
+        entry->snapshot.edid = (const uint8_t *) (entry + 1);
+        entry->snapshot.valid =
+            edid_info_decode(&entry->snapshot.info, data, length);
+        if (entry->snapshot.valid)
+            _decode_caps(&entry->snapshot, data, length);
+    }
+
+    pthread_mutex_lock(&registry->lock);
+
+    if (entry)
+        entry->snapshot.generation = ++registry->generation;
+
+    previous = __atomic_exchange_n(&registry->current[connector], entry,
+                                   __ATOMIC_SEQ_CST);
+    if (previous) {
+        previous->epoch = __atomic_fetch_add(&registry->epoch, 1,
+                                             __ATOMIC_SEQ_CST);
+        previous->next = registry->retired;
+        registry->retired = previous;
+    }
+
+    _reclaim(registry);
+
+    pthread_mutex_unlock(&registry->lock);
+    return true;
+}
+
+size_t
+eds_registry_reclaim(struct eds_registry * const registry)
+{
+    size_t reclaimed;
+
+    pthread_mutex_lock(&registry->lock);
+    reclaimed = _reclaim(registry);
+    pthread_mutex_unlock(&registry->lock);
+
+    return reclaimed;
+}
+
+struct eds_registry_reader *
+eds_registry_reader_new(struct eds_registry * const registry)
+{
+    struct eds_registry_reader *reader;
+
+    if (posix_memalign((void **) &reader, 64, sizeof(*reader)))
+        return NULL;
+
+    reader->epoch = EDS_REGISTRY_QUIESCENT;
+    reader->registry = registry;
+
+    pthread_mutex_lock(&registry->lock);
+    reader->next = registry->readers;
+    registry->readers = reader;
+    pthread_mutex_unlock(&registry->lock);
+
+    return reader;
+}
+
+void
+eds_registry_reader_free(struct eds_registry_reader * const reader)
+{
+    struct eds_registry *registry;
+
+    if (!reader)
+        return;
+
+    registry = reader->registry;
+
+    pthread_mutex_lock(&registry->lock);
+    for (struct eds_registry_reader **link = &registry->readers; *link;
+         link = &(*link)->next) {
+        if (*link == reader) {
+            *link = reader->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registry->lock);
+
+    free(reader);
+}
+
+void
+eds_registry_read_lock(struct eds_registry_reader * const reader)
+{
+    __atomic_store_n(&reader->epoch,
+                     __atomic_load_n(&reader->registry->epoch, __ATOMIC_RELAXED),
+                     __ATOMIC_RELAXED);
+
+    /* the epoch must be visible before any snapshot pointer is loaded */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+void
+eds_registry_read_unlock(struct eds_registry_reader * const reader)
+{
+    __atomic_store_n(&reader->epoch, EDS_REGISTRY_QUIESCENT, __ATOMIC_RELEASE);
+}
+
+const struct eds_snapshot *
+eds_registry_get(const struct eds_registry_reader * const reader,
+                 const uint32_t connector)
+{
+    const struct eds_registry * const registry = reader->registry;
+    const struct entry *entry;
+
+    if (connector >= registry->connectors)
+        return NULL;
+
+    entry = __atomic_load_n(&registry->current[connector], __ATOMIC_ACQUIRE);
+    return entry ? &entry->snapshot : NULL;
+}
+
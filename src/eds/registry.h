@@ -0,0 +1,122 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_registry_h
+#define eds_registry_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "info.h"
+#include "color.h"
+
+/*!
+ * An immutable decoded EDID.  Snapshots are owned by the registry and remain
+ * valid for a reader until it leaves the read side section in which it
+ * obtained them.
+ */
+struct eds_snapshot {
+    uint32_t         connector;
+    uint64_t         generation;                /* bumped on every publish */
+    bool             valid;                     /* info holds a decoded EDID */
+    struct edid_info info;
+
+    /* HDR */
+    uint8_t          eotfs;                     /* EDID_COLOR_EOTF_MASK bits */
+    float            max_luminance;             /* cd/m², 0 if undeclared */
+    float            max_frame_average_luminance;
+    float            min_luminance;
+
+    /* VRR, from the HDMI forum VSDB or an EDID 1.4 continuous frequency display */
+    bool             vrr;
+    uint32_t         min_vfreq;                 /* mHz */
+    uint32_t         max_vfreq;                 /* mHz */
+
+    size_t           length;
+    const uint8_t   *edid;
+};
+
+/*!
+ * A map from connector ids to snapshots.  Publishing swaps the connector's
+ * snapshot pointer; the previous snapshot is retired and freed once every
+ * reader which might still hold it has left its read side section (epoch
+ * based reclamation).  Readers never block and never write shared state other
+ * than their own epoch.  Publishers and reader registration are serialised by
+ * a mutex.
+ */
+struct eds_registry;
+struct eds_registry_reader;
+
+/*! a registry for connector ids below \p connectors */
+struct eds_registry *
+eds_registry_new(size_t connectors);
+
+/*! free the registry and every snapshot; no reader may be registered */
+void
+eds_registry_free(struct eds_registry *registry);
+
+/*!
+ * Decode the EDID in \p data, along with its HDR and VRR capabilities, into a
+ * new snapshot for \p connector, or remove the connector's snapshot if \p data
+ * is NULL.  Returns false if \p connector is out of range or on allocation
+ * failure.
+ */
+bool
+eds_registry_publish(struct eds_registry *registry, uint32_t connector,
+                     const uint8_t *data, size_t length);
+
+/*! free the retired snapshots which no reader can observe any longer */
+size_t
+eds_registry_reclaim(struct eds_registry *registry);
+
+/*! register the calling thread as a reader */
+struct eds_registry_reader *
+eds_registry_reader_new(struct eds_registry *registry);
+
+void
+eds_registry_reader_free(struct eds_registry_reader *reader);
+
+/*! enter a read side section; sections do not nest */
+void
+eds_registry_read_lock(struct eds_registry_reader *reader);
+
+void
+eds_registry_read_unlock(struct eds_registry_reader *reader);
+
+/*!
+ * The current snapshot of \p connector, NULL if there is none.  Must be
+ * called within a read side section of \p reader.
+ */
+const struct eds_snapshot *
+eds_registry_get(const struct eds_registry_reader *reader, uint32_t connector);
+
+#endif
+
@@ -0,0 +1,485 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "edid.h"
+#include "hdmi.h"
+#include "stats.h"
+#include "cea861.h"
+
+#define HLL_REGISTERS                           (1 << EDS_STATS_HLL_PRECISION)
+
+struct product_count {
+    uint32_t key;                               /* manufacturer << 16 | product */
+    uint64_t count;
+};
+
+struct eds_stats {
+    uint64_t             total;
+    uint64_t             invalid;
+    uint64_t             cea861;
+    uint64_t             hdmi;
+
+    uint64_t             version[16][16];
+    uint64_t             vic[0x100];
+    uint64_t             audio_format[16];
+    uint64_t             audio_extended[32];
+    uint64_t             max_tmds_clock[0x100];
+
+    uint8_t              hll[HLL_REGISTERS];
+
+    size_t               products;
+    size_t               capacity;
+    struct product_count *product;
+};
+
+static const char * const audio_format_names[] = {
+    [CEA861_AUDIO_FORMAT_RESERVED] = "reserved",
+    [CEA861_AUDIO_FORMAT_LPCM]     = "LPCM",
+    [CEA861_AUDIO_FORMAT_AC_3]     = "AC-3",
+    [CEA861_AUDIO_FORMAT_MPEG_1]   = "MPEG-1",
+    [CEA861_AUDIO_FORMAT_MP3]      = "MP3",
+    [CEA861_AUDIO_FORMAT_MPEG2]    = "MPEG-2",
+    [CEA861_AUDIO_FORMAT_AAC_LC]   = "AAC LC",
+    [CEA861_AUDIO_FORMAT_DTS]      = "DTS",
+    [CEA861_AUDIO_FORMAT_ATRAC]    = "ATRAC",
+    [CEA861_AUDIO_FORMAT_DSD]      = "DSD",
+    [CEA861_AUDIO_FORMAT_E_AC_3]   = "E-AC-3",
+    [CEA861_AUDIO_FORMAT_DTS_HD]   = "DTS-HD",
+    [CEA861_AUDIO_FORMAT_MLP]      = "MLP",
+    [CEA861_AUDIO_FORMAT_DST]      = "DST",
+    [CEA861_AUDIO_FORMAT_WMA_PRO]  = "WMA Pro",
+    [CEA861_AUDIO_FORMAT_EXTENDED] = "extended",
+};
+
+
+static inline uint64_t
+_mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= UINT64_C(0xff51afd7ed558ccd);
+    value ^= value >> 33;
+    value *= UINT64_C(0xc4ceb9fe1a85ec53);
+    value ^= value >> 33;
+    return value;
+}
+
+static inline uint64_t
+_hash(const uint8_t * const data, const size_t length)
+{
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ data[i]) * UINT64_C(0x100000001b3);
+
+    return _mix(hash);
+}
+
+static bool
+_count_product(struct eds_stats * const stats, const uint32_t key,
+               const uint64_t count)
+{
+    size_t slot;
+
+    if ((stats->products + 1) * 2 > stats->capacity) {
+        const size_t capacity = stats->capacity ? stats->capacity << 1 : 1024;
+        struct product_count * const table = calloc(capacity, sizeof(*table));
+
+        if (!table)
+            return false;
+
+        for (size_t i = 0; i < stats->capacity; i++) {
+            if (!stats->product[i].count)
+                continue;
+
+            slot = _mix(stats->product[i].key) & (capacity - 1);
+            while (table[slot].count)
+                slot = (slot + 1) & (capacity - 1);
+            table[slot] = stats->product[i];
+        }
+
+        free(stats->product);
+        stats->product = table;
+        stats->capacity = capacity;
+    }
+
+    slot = _mix(key) & (stats->capacity - 1);
+    while (stats->product[slot].count && stats->product[slot].key != key)
+        slot = (slot + 1) & (stats->capacity - 1);
+
+    if (!stats->product[slot].count) {
+        stats->product[slot].key = key;
+        stats->products++;
+    }
+    stats->product[slot].count += count;
+
+    return true;
+}
+
+struct _cea861_summary {
+    uint64_t vics[4];
+    uint32_t audio;
+    uint32_t extended;
+    int      tmds;
+};
+
+static void
+_add_svd(void * const context, const uint8_t block,
+         const struct cea861_short_video_descriptor * const svd)
+{
+    struct _cea861_summary * const summary = context;
+    const uint8_t vic = cea861_short_video_descriptor_vic(svd);
+
+    (void) block;
+
+    if (vic)
+        summary->vics[vic >> 6] |= UINT64_C(1) << (vic & 0x3f);
+}
+
+static void
+_add_sad(void * const context, const uint8_t block,
+         const struct cea861_short_audio_descriptor * const sad)
+{
+    struct _cea861_summary * const summary = context;
+    const uint8_t format =
+        cea861_short_audio_descriptor_get_audio_format((const uint8_t *) sad);
+
+    (void) block;
+
+    summary->audio |= 1 << format;
+    if (format == CEA861_AUDIO_FORMAT_EXTENDED)
+        summary->extended |= UINT32_C(1) << cea861_short_audio_descriptor_get_extension_code((const uint8_t *) sad);
+}
+
+static void
+_add_vsdb(void * const context, const uint8_t block,
+          const struct cea861_vendor_specific_data_block * const vsdb)
+{
+    struct _cea861_summary * const summary = context;
+    const uint8_t length = cea861_data_block_get_length((const uint8_t *) vsdb);
+    const uint8_t * const oui = vsdb->ieee_registration;
+
+    (void) block;
+
+    if (length < 5 || oui[2] != HDMI_OUI[0] ||
+        oui[1] != HDMI_OUI[1] || oui[0] != HDMI_OUI[2])
+        return;
+
+    summary->tmds = length >= HDMI_VSDB_MAX_TMDS_OFFSET
+                  ? hdmi_vendor_specific_data_block_get_max_tmds_clock((const uint8_t *) vsdb)
+                  : 0;
+}
+
+static const struct edid_visitor _cea861_visitor = {
+    .short_video_descriptor = _add_svd,
+    .short_audio_descriptor = _add_sad,
+    .vendor_specific        = _add_vsdb,
+};
+
+
+struct eds_stats *
+eds_stats_new(void)
+{
+    return calloc(1, sizeof(struct eds_stats));
+}
+
+void
+eds_stats_free(struct eds_stats * const stats)
+{
+    if (!stats)
+        return;
+
+    free(stats->product);
+    free(stats);
+}
+
+void
+eds_stats_add(struct eds_stats * const stats, const uint8_t * const data,
+              const size_t length)
+{
+    const struct edid * const edid = (struct edid *) data;
+    struct _cea861_summary summary = { .tmds = -1 };
+    bool cea861 = false;
+    uint64_t hash;
+    size_t blocks;
+
+    stats->total++;
+
+    if (length < EDID_BLOCK_SIZE || memcmp(data, EDID_HEADER, sizeof(EDID_HEADER))) {
+        stats->invalid++;
+        return;
+    }
+
+    blocks = length / EDID_BLOCK_SIZE;
+    if (blocks > (size_t) edid->extensions + 1)
+        blocks = edid->extensions + 1;
+
+    hash = _hash(data, blocks * EDID_BLOCK_SIZE);
+    {
+        const uint32_t index = hash >> (64 - EDS_STATS_HLL_PRECISION);
+        const uint64_t rest = hash << EDS_STATS_HLL_PRECISION;
+        const uint8_t rank = rest ? __builtin_clzll(rest) + 1
+                                  : 64 - EDS_STATS_HLL_PRECISION + 1;
+
+        if (rank > stats->hll[index])
+            stats->hll[index] = rank;
+    }
+
+    stats->version[edid->version & 0xf][edid->revision & 0xf]++;
+    _count_product(stats,
+                   ((uint32_t) data[0x08] << 24) | (data[0x09] << 16) |
+                   (data[0x0b] << 8) | data[0x0a], 1);
+
+    for (size_t i = 1; i < blocks; i++) {
+        const uint8_t * const block = data + i * EDID_BLOCK_SIZE;
+
+        if (block[0] != EDID_EXTENSION_CEA)
+            continue;
+
+        cea861 = true;
+        cea861_visit((struct cea861_timing_block *) block, i, &_cea861_visitor,
+                     &summary);
+    }
+
+    stats->cea861 += cea861;
+    stats->hdmi += summary.tmds >= 0;
+    if (summary.tmds >= 0)
+        stats->max_tmds_clock[summary.tmds]++;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(summary.vics); i++)
+        for (uint64_t bits = summary.vics[i]; bits; bits &= bits - 1)
+            stats->vic[(i << 6) + __builtin_ctzll(bits)]++;
+    for (uint32_t bits = summary.audio; bits; bits &= bits - 1)
+        stats->audio_format[__builtin_ctz(bits)]++;
+    for (uint32_t bits = summary.extended; bits; bits &= bits - 1)
+        stats->audio_extended[__builtin_ctz(bits)]++;
+}
+
+bool
+eds_stats_merge(struct eds_stats * const stats,
+                const struct eds_stats * const other)
+{
+    stats->total += other->total;
+    stats->invalid += other->invalid;
+    stats->cea861 += other->cea861;
+    stats->hdmi += other->hdmi;
+
+    for (size_t i = 0; i < 16; i++)
+        for (size_t j = 0; j < 16; j++)
+            stats->version[i][j] += other->version[i][j];
+    for (size_t i = 0; i < ARRAY_SIZE(stats->vic); i++)
+        stats->vic[i] += other->vic[i];
+    for (size_t i = 0; i < ARRAY_SIZE(stats->audio_format); i++)
+        stats->audio_format[i] += other->audio_format[i];
+    for (size_t i = 0; i < ARRAY_SIZE(stats->audio_extended); i++)
+        stats->audio_extended[i] += other->audio_extended[i];
+    for (size_t i = 0; i < ARRAY_SIZE(stats->max_tmds_clock); i++)
+        stats->max_tmds_clock[i] += other->max_tmds_clock[i];
+    for (size_t i = 0; i < HLL_REGISTERS; i++)
+        if (other->hll[i] > stats->hll[i])
+            stats->hll[i] = other->hll[i];
+
+    for (size_t i = 0; i < other->capacity; i++)
+        if (other->product[i].count &&
+            !_count_product(stats, other->product[i].key, other->product[i].count))
+            return false;
+
+    return true;
+}
+
+uint64_t
+eds_stats_total(const struct eds_stats * const stats)
+{
+    return stats->total;
+}
+
+uint64_t
+eds_stats_distinct(const struct eds_stats * const stats)
+{
+    const double m = HLL_REGISTERS;
+    const double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double sum = 0.0, estimate;
+    unsigned zeros = 0;
+
+    for (size_t i = 0; i < HLL_REGISTERS; i++) {
+        sum += ldexp(1.0, -stats->hll[i]);
+        zeros += !stats->hll[i];
+    }
+
+    estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros)
+        estimate = m * log(m / zeros);
+
+    return (uint64_t) (estimate + 0.5);
+}
+
+
+static int
+_compare_products(const void * const lhs, const void * const rhs)
+{
+    const struct product_count * const a = lhs;
+    const struct product_count * const b = rhs;
+
+    if (a->count != b->count)
+        return a->count < b->count ? 1 : -1;
+    return a->key < b->key ? -1 : a->key > b->key;
+}
+
+struct writer {
+    FILE                 *stream;
+    enum eds_stats_format format;
+    bool                 first;
+};
+
+static void
+_begin(struct writer * const writer, const char * const metric)
+{
+    if (writer->format == EDS_STATS_FORMAT_JSON)
+        fprintf(writer->stream, ",\n  \"%s\": {", metric);
+    writer->first = true;
+}
+
+static void
+_entry(struct writer * const writer, const char * const metric,
+       const char * const key, const uint64_t count)
+{
+    if (writer->format == EDS_STATS_FORMAT_CSV) {
+        fprintf(writer->stream, "%s,%s,%llu\n", metric, key,
+                (unsigned long long) count);
+    } else {
+        fprintf(writer->stream, "%s\n    \"%s\": %llu",
+                writer->first ? "" : ",", key, (unsigned long long) count);
+    }
+    writer->first = false;
+}
+
+static void
+_end(struct writer * const writer)
+{
+    if (writer->format == EDS_STATS_FORMAT_JSON)
+        fprintf(writer->stream, "%s}", writer->first ? "" : "\n  ");
+}
+
+void
+eds_stats_write(const struct eds_stats * const stats,
+                const enum eds_stats_format format, FILE * const stream)
+{
+    struct writer writer = { .stream = stream, .format = format };
+    struct product_count *products;
+    char key[32];
+    size_t count = 0;
+
+    if (format == EDS_STATS_FORMAT_CSV) {
+        fprintf(stream, "metric,key,count\n");
+        fprintf(stream, "total,,%llu\n", (unsigned long long) stats->total);
+        fprintf(stream, "invalid,,%llu\n", (unsigned long long) stats->invalid);
+        fprintf(stream, "distinct,,%llu\n", (unsigned long long) eds_stats_distinct(stats));
+        fprintf(stream, "cea861,,%llu\n", (unsigned long long) stats->cea861);
+        fprintf(stream, "hdmi,,%llu\n", (unsigned long long) stats->hdmi);
+    } else {
+        fprintf(stream, "{\n");
+        fprintf(stream, "  \"total\": %llu", (unsigned long long) stats->total);
+        fprintf(stream, ",\n  \"invalid\": %llu", (unsigned long long) stats->invalid);
+        fprintf(stream, ",\n  \"distinct\": %llu", (unsigned long long) eds_stats_distinct(stats));
+        fprintf(stream, ",\n  \"cea861\": %llu", (unsigned long long) stats->cea861);
+        fprintf(stream, ",\n  \"hdmi\": %llu", (unsigned long long) stats->hdmi);
+    }
+
+    _begin(&writer, "version");
+    for (unsigned i = 0; i < 16; i++) {
+        for (unsigned j = 0; j < 16; j++) {
+            if (!stats->version[i][j])
+                continue;
+            snprintf(key, sizeof(key), "%u.%u", i, j);
+            _entry(&writer, "version", key, stats->version[i][j]);
+        }
+    }
+    _end(&writer);
+
+    if ((products = malloc(stats->products * sizeof(*products) + 1))) {
+        for (size_t i = 0; i < stats->capacity; i++)
+            if (stats->product[i].count)
+                products[count++] = stats->product[i];
+        if (count)
+            qsort(products, count, sizeof(*products), _compare_products);
+    }
+
+    _begin(&writer, "manufacturer_product");
+    for (size_t i = 0; i < count; i++) {
+        char manufacturer[4];
+
+        edid_manufacturer_name(products[i].key >> 16, manufacturer);
+
+        snprintf(key, sizeof(key), "%s:%u", manufacturer,
+                 (unsigned) (products[i].key & 0xffff));
+        _entry(&writer, "manufacturer_product", key, products[i].count);
+    }
+    _end(&writer);
+    free(products);
+
+    _begin(&writer, "vic");
+    for (unsigned i = 0; i < ARRAY_SIZE(stats->vic); i++) {
+        if (!stats->vic[i])
+            continue;
+        snprintf(key, sizeof(key), "%u", i);
+        _entry(&writer, "vic", key, stats->vic[i]);
+    }
+    _end(&writer);
+
+    _begin(&writer, "audio_format");
+    for (unsigned i = 0; i < ARRAY_SIZE(stats->audio_format); i++) {
+        if (!stats->audio_format[i])
+            continue;
+        _entry(&writer, "audio_format", audio_format_names[i],
+               stats->audio_format[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(stats->audio_extended); i++) {
+        if (!stats->audio_extended[i])
+            continue;
+        snprintf(key, sizeof(key), "extended %u", i);
+        _entry(&writer, "audio_format", key, stats->audio_extended[i]);
+    }
+    _end(&writer);
+
+    _begin(&writer, "max_tmds_clock");
+    for (unsigned i = 0; i < ARRAY_SIZE(stats->max_tmds_clock); i++) {
+        if (!stats->max_tmds_clock[i])
+            continue;
+        snprintf(key, sizeof(key), "%u", i * 5);
+        _entry(&writer, "max_tmds_clock", key, stats->max_tmds_clock[i]);
+    }
+    _end(&writer);
+
+    if (format == EDS_STATS_FORMAT_JSON)
+        fprintf(stream, "\n}\n");
+}
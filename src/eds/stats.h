@@ -0,0 +1,78 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_stats_h
+#define eds_stats_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define EDS_STATS_HLL_PRECISION                 (12)
+
+/*!
+ * Histograms over a corpus of EDIDs.  A collector is owned by exactly one
+ * thread; collectors are combined with eds_stats_merge once the workers are
+ * done, so no state is shared while decoding.
+ */
+struct eds_stats;
+
+enum eds_stats_format {
+    EDS_STATS_FORMAT_CSV,
+    EDS_STATS_FORMAT_JSON,
+};
+
+struct eds_stats *
+eds_stats_new(void);
+
+void
+eds_stats_free(struct eds_stats *stats);
+
+/*! account for the EDID in \p data; malformed input is counted as invalid */
+void
+eds_stats_add(struct eds_stats *stats, const uint8_t *data, size_t length);
+
+/*! fold \p other into \p stats; returns false on allocation failure */
+bool
+eds_stats_merge(struct eds_stats *stats, const struct eds_stats *other);
+
+uint64_t
+eds_stats_total(const struct eds_stats *stats);
+
+/*! HyperLogLog estimate of the number of distinct EDIDs seen */
+uint64_t
+eds_stats_distinct(const struct eds_stats *stats);
+
+void
+eds_stats_write(const struct eds_stats *stats, enum eds_stats_format format,
+                FILE *stream);
+
+#endif
@@ -0,0 +1,452 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <ctype.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#include "sysfs.h"
+
+#define SYSFS_DEFAULT_ROOT                      "/sys"
+#define SYSFS_DRM_CLASS                         "class/drm"
+
+#define SYSFS_MAX_EDID_SIZE                     (EDID_BLOCK_SIZE * (EDID_MAX_EXTENSIONS + 1))
+#define UEVENT_BUFFER_SIZE                      (0x2000)
+
+struct connector {
+    struct eds_sysfs_connector public;
+    uint8_t                    *edid;
+    char                       status[16];
+    bool                       dirty;
+};
+
+struct eds_sysfs_scanner {
+    char             *path;
+    int              fd;
+    bool             rescan;
+
+    size_t           count;
+    struct connector *connectors;
+};
+
+
+static ssize_t
+_read_attribute(const struct eds_sysfs_scanner * const scanner,
+                const char * const connector, const char * const attribute,
+                void * const buffer, const size_t size)
+{
+    char *path = NULL;
+    ssize_t length = 0, rv;
+    int fd;
+
+    if (asprintf(&path, "%s/%s/%s", scanner->path, connector, attribute) < 0)
+        return -ENOMEM;
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    free(path);
+    if (fd < 0)
+        return -errno;
+
+    while ((size_t) length < size) {
+        if ((rv = read(fd, (uint8_t *) buffer + length, size - length)) < 0) {
+            if (errno == EINTR)
+                continue;
+            length = -errno;
+            break;
+        }
+        if (rv == 0)
+            break;
+        length += rv;
+    }
+
+    close(fd);
+    return length;
+}
+
+static void
+_read_status(const struct eds_sysfs_scanner * const scanner,
+             const char * const connector, char status[16])
+{
+    ssize_t length;
+
+    length = _read_attribute(scanner, connector, "status", status, 15);
+    if (length < 0)
+        length = 0;
+    status[length] = '\0';
+    status[strcspn(status, "\n")] = '\0';
+}
+
+static void
+_refresh_connector(const struct eds_sysfs_scanner * const scanner,
+                   struct connector * const connector)
+{
+    struct eds_sysfs_connector * const public = &connector->public;
+    ssize_t length;
+
+    _read_status(scanner, public->name, connector->status);
+    public->connected = !strcmp(connector->status, "connected");
+    public->valid = false;
+    public->length = 0;
+
+    if (!connector->edid)
+        connector->edid = malloc(SYSFS_MAX_EDID_SIZE);
+    public->edid = connector->edid;
+
+    if (public->connected && connector->edid) {
+        length = _read_attribute(scanner, public->name, "edid",
+                                 connector->edid, SYSFS_MAX_EDID_SIZE);
+        if (length > 0) {
+            public->length = length;
+            public->valid = edid_info_decode(&public->info, connector->edid,
+                                             length);
+        }
+    }
+
+    if (!public->valid)
+        memset(&public->info, 0, sizeof(public->info));
+
+    connector->dirty = false;
+}
+
+static bool
+_is_connector(const char * const name)
+{
+    const char *p = name;
+
+    if (strncmp(p, "card", 4))
+        return false;
+    for (p = p + 4; isdigit((unsigned char) *p); p++)
+        ;
+    return p > name + 4 && *p == '-' && p[1];
+}
+
+static int
+_compare_connectors(const void * const lhs, const void * const rhs)
+{
+    return strcmp(((const struct connector *) lhs)->public.name,
+                  ((const struct connector *) rhs)->public.name);
+}
+
+static int
+_scan(struct eds_sysfs_scanner * const scanner)
+{
+    struct connector *connectors = NULL, *entry;
+    size_t count = 0, capacity = 0;
+    struct dirent *dirent;
+    DIR *dir;
+
+    /* a system without DRM simply has no connectors */
+    if ((dir = opendir(scanner->path)) == NULL && errno != ENOENT)
+        return -errno;
+
+    while (dir && (dirent = readdir(dir))) {
+        if (!_is_connector(dirent->d_name) ||
+            strlen(dirent->d_name) >= sizeof(entry->public.name))
+            continue;
+
+        if (count == capacity) {
+            capacity = capacity ? capacity << 1 : 8;
+            entry = realloc(connectors, capacity * sizeof(*connectors));
+            if (!entry) {
+                closedir(dir);
+                free(connectors);
+                return -ENOMEM;
+            }
+            connectors = entry;
+        }
+
+        entry = &connectors[count++];
+        memset(entry, 0, sizeof(*entry));
+        strcpy(entry->public.name, dirent->d_name);
+        entry->dirty = true;
+    }
+
+    if (dir)
+        closedir(dir);
+
+    if (count)
+        qsort(connectors, count, sizeof(*connectors), _compare_connectors);
+
+    /*
+     * Only now that nothing can fail, carry over the cached state of the
+     * connectors which we already know; the old array is sorted as well.
+     */
+    for (size_t i = 0; i < scanner->count; i++) {
+        struct connector * const old = &scanner->connectors[i];
+
+        entry = count ? bsearch(old, connectors, count, sizeof(*connectors),
+                                _compare_connectors)
+                      : NULL;
+        if (entry) {
+            *entry = *old;
+            continue;
+        }
+
+        free(old->edid);
+    }
+    free(scanner->connectors);
+
+    scanner->connectors = connectors;
+    scanner->count = count;
+    scanner->rescan = false;
+
+    return 0;
+}
+
+static int
+_open_uevent_socket(void)
+{
+    const struct sockaddr_nl address = {
+        .nl_family = AF_NETLINK,
+        .nl_groups = 1,                         /* kernel events */
+    };
+    int fd;
+
+    fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                NETLINK_KOBJECT_UEVENT);
+    if (fd < 0)
+        return -1;
+
+    if (bind(fd, (const struct sockaddr *) &address, sizeof(address)) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/*!
+ * Handle a single kernel uevent.  DRM reports hotplug against the card (and on
+ * newer kernels against the connector) so invalidate everything which lives
+ * below the reported device.  Only devices appearing or disappearing require
+ * the directory to be enumerated again.
+ */
+static void
+_handle_uevent(struct eds_sysfs_scanner * const scanner,
+               const char * const message, const size_t length)
+{
+    const char *devpath = NULL, *action = NULL, *device;
+    bool drm = false;
+
+    for (const char *p = message; p < message + length; p += strlen(p) + 1) {
+        if (!strcmp(p, "SUBSYSTEM=drm"))
+            drm = true;
+        else if (!strncmp(p, "DEVPATH=", 8))
+            devpath = p + 8;
+        else if (!strncmp(p, "ACTION=", 7))
+            action = p + 7;
+    }
+
+    if (!drm || !devpath)
+        return;
+
+    if (action && (!strcmp(action, "add") || !strcmp(action, "remove")))
+        scanner->rescan = true;
+
+    device = strrchr(devpath, '/');
+    device = device ? device + 1 : devpath;
+
+    if (_is_connector(device)) {
+        eds_sysfs_scanner_invalidate(scanner, device);
+        return;
+    }
+
+    for (size_t i = 0; i < scanner->count; i++) {
+        const char * const name = scanner->connectors[i].public.name;
+        const size_t prefix = strlen(device);
+
+        if (!strncmp(name, device, prefix) && name[prefix] == '-')
+            scanner->connectors[i].dirty = true;
+    }
+}
+
+
+struct eds_sysfs_scanner *
+eds_sysfs_scanner_new(const char * const root)
+{
+    struct eds_sysfs_scanner *scanner;
+
+    if ((scanner = calloc(1, sizeof(*scanner))) == NULL)
+        return NULL;
+
+    if (asprintf(&scanner->path, "%s/" SYSFS_DRM_CLASS,
+                 root ? root : SYSFS_DEFAULT_ROOT) < 0) {
+        free(scanner);
+        return NULL;
+    }
+
+    scanner->fd = -1;
+    if (!root || !strcmp(root, SYSFS_DEFAULT_ROOT))
+        scanner->fd = _open_uevent_socket();
+
+    scanner->rescan = true;
+    if (eds_sysfs_scanner_refresh(scanner) < 0) {
+        eds_sysfs_scanner_free(scanner);
+        return NULL;
+    }
+
+    return scanner;
+}
+
+void
+eds_sysfs_scanner_free(struct eds_sysfs_scanner * const scanner)
+{
+    if (!scanner)
+        return;
+
+    if (scanner->fd >= 0)
+        close(scanner->fd);
+
+    for (size_t i = 0; i < scanner->count; i++)
+        free(scanner->connectors[i].edid);
+    free(scanner->connectors);
+    free(scanner->path);
+    free(scanner);
+}
+
+int
+eds_sysfs_scanner_fd(const struct eds_sysfs_scanner * const scanner)
+{
+    return scanner->fd;
+}
+
+int
+eds_sysfs_scanner_dispatch(struct eds_sysfs_scanner * const scanner)
+{
+    char buffer[UEVENT_BUFFER_SIZE];
+    struct sockaddr_nl sender;
+    struct iovec iov = { .iov_base = buffer, .iov_len = sizeof(buffer) - 1 };
+    struct msghdr message = {
+        .msg_name = &sender,
+        .msg_namelen = sizeof(sender),
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+    };
+    ssize_t length;
+
+    if (scanner->fd < 0)
+        return eds_sysfs_scanner_refresh(scanner);
+
+    for (;;) {
+        message.msg_namelen = sizeof(sender);
+        if ((length = recvmsg(scanner->fd, &message, 0)) < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            return -errno;
+        }
+
+        /* ignore anything which was not sent by the kernel */
+        if (message.msg_namelen != sizeof(sender) || sender.nl_pid)
+            continue;
+
+        buffer[length] = '\0';
+        _handle_uevent(scanner, buffer, length);
+    }
+
+    return eds_sysfs_scanner_refresh(scanner);
+}
+
+int
+eds_sysfs_scanner_check_status(struct eds_sysfs_scanner * const scanner)
+{
+    char status[16];
+
+    for (size_t i = 0; i < scanner->count; i++) {
+        struct connector * const connector = &scanner->connectors[i];
+
+        _read_status(scanner, connector->public.name, status);
+        if (strcmp(status, connector->status))
+            connector->dirty = true;
+    }
+
+    return eds_sysfs_scanner_refresh(scanner);
+}
+
+void
+eds_sysfs_scanner_invalidate(struct eds_sysfs_scanner * const scanner,
+                             const char * const name)
+{
+    bool found = false;
+
+    for (size_t i = 0; i < scanner->count; i++) {
+        if (!name || !strcmp(scanner->connectors[i].public.name, name)) {
+            scanner->connectors[i].dirty = true;
+            found = true;
+        }
+    }
+
+    /* a connector which we do not know yet requires enumerating them again */
+    if (!name || !found)
+        scanner->rescan = true;
+}
+
+int
+eds_sysfs_scanner_refresh(struct eds_sysfs_scanner * const scanner)
+{
+    int rv, refreshed = 0;
+
+    if (scanner->rescan && (rv = _scan(scanner)) < 0)
+        return rv;
+
+    for (size_t i = 0; i < scanner->count; i++) {
+        if (!scanner->connectors[i].dirty)
+            continue;
+
+        _refresh_connector(scanner, &scanner->connectors[i]);
+        refreshed++;
+    }
+
+    return refreshed;
+}
+
+size_t
+eds_sysfs_scanner_count(const struct eds_sysfs_scanner * const scanner)
+{
+    return scanner->count;
+}
+
+const struct eds_sysfs_connector *
+eds_sysfs_scanner_connector(const struct eds_sysfs_scanner * const scanner,
+                            const size_t index)
+{
+    return index < scanner->count ? &scanner->connectors[index].public : NULL;
+}
@@ -0,0 +1,108 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_sysfs_h
+#define eds_sysfs_h
+
+#include <stddef.h>
+
+#include "info.h"
+
+/*!
+ * A DRM connector as exposed under /sys/class/drm.  The decoded information is
+ * cached and only refreshed when the scanner observes a DRM uevent or a change
+ * of the connector's status attribute.
+ */
+struct eds_sysfs_connector {
+    char             name[64];                  /* e.g. card0-HDMI-A-1 */
+    bool             connected;
+    bool             valid;                     /* info holds a decoded EDID */
+
+    const uint8_t   *edid;
+    size_t           length;
+    struct edid_info info;
+};
+
+struct eds_sysfs_scanner;
+
+/*!
+ * Create a scanner rooted at \p root (the sysfs mount point, "/sys" if NULL).
+ * The kernel uevent socket is only opened for the real sysfs; scanners over a
+ * fake tree rely on eds_sysfs_scanner_check_status and explicit invalidation.
+ * The connectors are enumerated and decoded before returning.
+ */
+struct eds_sysfs_scanner *
+eds_sysfs_scanner_new(const char *root);
+
+void
+eds_sysfs_scanner_free(struct eds_sysfs_scanner *scanner);
+
+/*! the uevent socket to wait on, or -1 if uevents are unavailable */
+int
+eds_sysfs_scanner_fd(const struct eds_sysfs_scanner *scanner);
+
+/*!
+ * Drain pending uevents, invalidating the connectors of every card which
+ * reported a change, and refresh the invalidated entries.  Returns the number
+ * of refreshed connectors or a negative errno.
+ */
+int
+eds_sysfs_scanner_dispatch(struct eds_sysfs_scanner *scanner);
+
+/*!
+ * Re-read the status attribute of every connector, invalidating (and
+ * refreshing) those which changed.  Returns the number of refreshed connectors
+ * or a negative errno.
+ */
+int
+eds_sysfs_scanner_check_status(struct eds_sysfs_scanner *scanner);
+
+/*!
+ * Mark \p name as invalid.  The connectors are enumerated again on the next
+ * refresh if \p name is NULL (invalidating every connector) or unknown.
+ */
+void
+eds_sysfs_scanner_invalidate(struct eds_sysfs_scanner *scanner,
+                             const char *name);
+
+/*! refresh the invalidated connectors */
+int
+eds_sysfs_scanner_refresh(struct eds_sysfs_scanner *scanner);
+
+/* cached queries; these never touch the filesystem */
+
+size_t
+eds_sysfs_scanner_count(const struct eds_sysfs_scanner *scanner);
+
+const struct eds_sysfs_connector *
+eds_sysfs_scanner_connector(const struct eds_sysfs_scanner *scanner,
+                            size_t index);
+
+#endif
@@ -0,0 +1,216 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "edid.h"
+#include "cea861.h"
+#include "hdmi.h"
+#include "topology.h"
+
+#define EDS_TOPOLOGY_NODES                      (0x10000)
+
+struct eds_topology {
+    uint32_t count[EDS_TOPOLOGY_NODES];         /* sinks at or below */
+    uint16_t children[EDS_TOPOLOGY_NODES];      /* occupied input ports */
+
+    uint16_t *address;                          /* by sink */
+    size_t   sinks;
+};
+
+struct eds_topology *
+eds_topology_new(void)
+{
+    return calloc(1, sizeof(struct eds_topology));
+}
+
+void
+eds_topology_free(struct eds_topology * const topology)
+{
+    if (!topology)
+        return;
+
+    free(topology->address);
+    free(topology);
+}
+
+static void
+_link(struct eds_topology * const topology, uint16_t address)
+{
+    for (uint8_t depth = eds_topology_depth(address); depth; depth--) {
+        const uint8_t shift = (4 - depth) << 2;
+        const uint16_t parent = address & ~(0xf << shift);
+
+        if (!topology->count[address]++)
+            topology->children[parent] |= 1 << ((address >> shift) & 0xf);
+        address = parent;
+    }
+
+    topology->count[address]++;
+}
+
+static void
+_unlink(struct eds_topology * const topology, uint16_t address)
+{
+    for (uint8_t depth = eds_topology_depth(address); depth; depth--) {
+        const uint8_t shift = (4 - depth) << 2;
+        const uint16_t parent = address & ~(0xf << shift);
+
+        if (!--topology->count[address])
+            topology->children[parent] &= ~(1 << ((address >> shift) & 0xf));
+        address = parent;
+    }
+
+    topology->count[address]--;
+}
+
+bool
+eds_topology_set(struct eds_topology * const topology, const uint32_t sink,
+                 const uint16_t address)
+{
+    uint16_t previous;
+
+    if (address != EDS_TOPOLOGY_ADDRESS_INVALID &&
+        !eds_topology_address_valid(address))
+        return false;
+
+    if (sink >= topology->sinks) {
+        size_t sinks = topology->sinks ? topology->sinks : 64;
+        uint16_t *table;
+
+        if (address == EDS_TOPOLOGY_ADDRESS_INVALID)
+            return true;
+
+        while (sinks <= sink)
+            sinks <<= 1;
+
+        if (!(table = realloc(topology->address, sinks * sizeof(*table))))
+            return false;
+
+        for (size_t i = topology->sinks; i < sinks; i++)
+            table[i] = EDS_TOPOLOGY_ADDRESS_INVALID;
+
+        topology->address = table;
+        topology->sinks = sinks;
+    }
+
+    previous = topology->address[sink];
+    if (previous == address)
+        return true;
+
+    if (previous != EDS_TOPOLOGY_ADDRESS_INVALID)
+        _unlink(topology, previous);
+    if (address != EDS_TOPOLOGY_ADDRESS_INVALID)
+        _link(topology, address);
+
+    topology->address[sink] = address;
+    return true;
+}
+
+static void
+_vendor_specific(void * const context, const uint8_t block,
+                 const struct cea861_vendor_specific_data_block * const vsdb)
+{
+    const uint8_t length = cea861_data_block_get_length((const uint8_t *) vsdb);
+    const uint8_t * const oui = vsdb->ieee_registration;
+    uint16_t * const address = context;
+
+    (void) block;
+
+    if (*address != EDS_TOPOLOGY_ADDRESS_INVALID || length < 5 ||
+        oui[2] != HDMI_OUI[0] || oui[1] != HDMI_OUI[1] || oui[0] != HDMI_OUI[2])
+        return;
+
+    *address =
+        hdmi_vendor_specific_data_block_get_physical_address((const uint8_t *) vsdb);
+}
+
+static const struct edid_visitor _topology_visitor = {
+    .vendor_specific = _vendor_specific,
+};
+
+bool
+eds_topology_update(struct eds_topology * const topology, const uint32_t sink,
+                    const uint8_t * const data, const size_t length)
+{
+    uint16_t address = EDS_TOPOLOGY_ADDRESS_INVALID;
+
+    if (!edid_visit(data, length, &_topology_visitor, &address, NULL))
+        address = EDS_TOPOLOGY_ADDRESS_INVALID;
+
+    return eds_topology_set(topology, sink, address);
+}
+
+uint16_t
+eds_topology_address(const struct eds_topology * const topology,
+                     const uint32_t sink)
+{
+    if (sink >= topology->sinks)
+        return EDS_TOPOLOGY_ADDRESS_INVALID;
+    return topology->address[sink];
+}
+
+uint32_t
+eds_topology_count(const struct eds_topology * const topology,
+                   const uint16_t address)
+{
+    return topology->count[address];
+}
+
+uint16_t
+eds_topology_children(const struct eds_topology * const topology,
+                      const uint16_t address)
+{
+    return topology->children[address];
+}
+
+int
+eds_topology_path(const struct eds_topology * const topology,
+                  const uint32_t sink,
+                  struct eds_topology_hop hops[EDS_TOPOLOGY_MAX_DEPTH])
+{
+    const uint16_t address = eds_topology_address(topology, sink);
+    uint8_t depth;
+
+    if (address == EDS_TOPOLOGY_ADDRESS_INVALID)
+        return -1;
+
+    depth = eds_topology_depth(address);
+    for (uint8_t level = 0; level < depth; level++) {
+        const uint8_t shift = 12 - (level << 2);
+
+        hops[level].address = address & (0xfff0 << shift);
+        hops[level].port = (address >> shift) & 0xf;
+    }
+
+    return depth;
+}
+
@@ -0,0 +1,124 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_topology_h
+#define eds_topology_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define EDS_TOPOLOGY_ADDRESS_INVALID            (0xffff)
+#define EDS_TOPOLOGY_MAX_DEPTH                  (4)
+
+/*!
+ * The CEC physical address tree of an HDMI fabric.  Every address A.B.C.D is
+ * a node of a dense 64K entry index holding the number of sinks at or below it
+ * and a mask of its occupied input ports, so that the children of a node are
+ * a single load and the path to a sink is at most four steps.  Sinks are
+ * identified by a caller chosen index (e.g. a connector number); setting the
+ * address of one sink only touches the nodes on its old and new paths.
+ */
+struct eds_topology;
+
+/*! a step on the path to a sink: \p port of the device at \p address */
+struct eds_topology_hop {
+    uint16_t address;
+    uint8_t  port;
+};
+
+struct eds_topology *
+eds_topology_new(void);
+
+void
+eds_topology_free(struct eds_topology *topology);
+
+/*!
+ * Move \p sink to \p address, or remove it if \p address is
+ * EDS_TOPOLOGY_ADDRESS_INVALID.  Returns false if \p address is malformed or
+ * on allocation failure, in which case the topology is unchanged.
+ */
+bool
+eds_topology_set(struct eds_topology *topology, uint32_t sink,
+                 uint16_t address);
+
+/*!
+ * Move \p sink to the physical address of the HDMI VSDB of the EDID in
+ * \p data, removing it if there is none.
+ */
+bool
+eds_topology_update(struct eds_topology *topology, uint32_t sink,
+                    const uint8_t *data, size_t length);
+
+/*! physical address of \p sink, EDS_TOPOLOGY_ADDRESS_INVALID if unknown */
+uint16_t
+eds_topology_address(const struct eds_topology *topology, uint32_t sink);
+
+/*! number of sinks at or below \p address */
+uint32_t
+eds_topology_count(const struct eds_topology *topology, uint16_t address);
+
+/*! mask of the input ports (bit n for port n) of \p address leading to sinks */
+uint16_t
+eds_topology_children(const struct eds_topology *topology, uint16_t address);
+
+/*!
+ * Fill \p hops with the route from the root to \p sink, one entry per device
+ * between them.  Returns the number of hops, or -1 if \p sink is unknown.
+ */
+int
+eds_topology_path(const struct eds_topology *topology, uint32_t sink,
+                  struct eds_topology_hop hops[EDS_TOPOLOGY_MAX_DEPTH]);
+
+/*! number of levels below the root of \p address */
+static inline uint8_t
+eds_topology_depth(const uint16_t address)
+{
+    return (address & 0x000f) ? 4 :
+           (address & 0x00f0) ? 3 :
+           (address & 0x0f00) ? 2 :
+           (address & 0xf000) ? 1 : 0;
+}
+
+/*! address A.B.C.D is well formed if no port follows a zero */
+static inline bool
+eds_topology_address_valid(const uint16_t address)
+{
+    const uint8_t depth = eds_topology_depth(address);
+
+    for (uint8_t level = 0; level < depth; level++)
+        if (!(address & (0xf000 >> (level << 2))))
+            return false;
+
+    return true;
+}
+
+#endif
+
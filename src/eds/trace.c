@@ -0,0 +1,87 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <inttypes.h>
+
+#include "macros.h"
+#include "trace.h"
+
+static const char * const stage_names[] = {
+    [EDS_TRACE_STAGE_OTHER]     = "other",
+    [EDS_TRACE_STAGE_IO]        = "io",
+    [EDS_TRACE_STAGE_CHECKSUM]  = "checksum",
+    [EDS_TRACE_STAGE_BASE]      = "base block",
+    [EDS_TRACE_STAGE_CEA861]    = "cea-861",
+    [EDS_TRACE_STAGE_FORMAT]    = "format",
+};
+
+static void
+_write_counters(FILE * const stream, const char * const name,
+                const uint64_t * const counters, const size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        if (counters[i])
+            fprintf(stream, "  %-26s 0x%02zx %12" PRIu64 "\n", name, i,
+                    counters[i]);
+}
+
+void
+eds_trace_write(const struct eds_trace * const trace, FILE * const stream)
+{
+    uint64_t total = 0;
+
+    for (size_t i = 0; i < EDS_TRACE_STAGES; i++)
+        total = total + trace->ns[i];
+
+    fprintf(stream, "%-14s %12s %14s %7s\n", "stage", "entries", "ns", "%");
+    for (size_t i = 0; i < EDS_TRACE_STAGES; i++)
+        fprintf(stream, "%-14s %12" PRIu64 " %14" PRIu64 " %6.2f%%\n",
+                stage_names[i], trace->entries[i], trace->ns[i],
+                total ? 100.0 * trace->ns[i] / total : 0.0);
+
+    fprintf(stream, "%-14s %12" PRIu64 " %14" PRIu64 "\n", "total",
+            trace->edids, total);
+    fprintf(stream, "EDIDs per second: %.1f\n",
+            total ? trace->edids * 1e9 / total : 0.0);
+
+    _write_counters(stream, "extension",
+                    trace->extension, ARRAY_SIZE(trace->extension));
+    _write_counters(stream, "unknown extension",
+                    trace->unknown_extension, ARRAY_SIZE(trace->unknown_extension));
+    _write_counters(stream, "unknown data block",
+                    trace->unknown_data_block, ARRAY_SIZE(trace->unknown_data_block));
+    _write_counters(stream, "unknown monitor descriptor",
+                    trace->unknown_monitor_descriptor,
+                    ARRAY_SIZE(trace->unknown_monitor_descriptor));
+    _write_counters(stream, "unknown audio format",
+                    trace->unknown_audio_format,
+                    ARRAY_SIZE(trace->unknown_audio_format));
+}
+
@@ -0,0 +1,124 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_trace_h
+#define eds_trace_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/*!
+ * Lightweight per-stage instrumentation.  Time is accounted exclusively to the
+ * innermost stage which has been entered, so a formatting stage nested in a
+ * decoding stage is not counted twice.  Unless EDS_TRACE is defined the
+ * EDS_TRACE_* hooks expand to nothing and the counters are never touched.
+ */
+
+enum eds_trace_stage {
+    EDS_TRACE_STAGE_OTHER,
+    EDS_TRACE_STAGE_IO,
+    EDS_TRACE_STAGE_CHECKSUM,
+    EDS_TRACE_STAGE_BASE,
+    EDS_TRACE_STAGE_CEA861,
+    EDS_TRACE_STAGE_FORMAT,
+    EDS_TRACE_STAGES,
+};
+
+struct eds_trace {
+    uint64_t             ns[EDS_TRACE_STAGES];
+    uint64_t             entries[EDS_TRACE_STAGES];
+    uint64_t             edids;
+
+    uint64_t             extension[256];
+    uint64_t             unknown_extension[256];
+    uint64_t             unknown_data_block[8];
+    uint64_t             unknown_monitor_descriptor[256];
+    uint64_t             unknown_audio_format[16];
+
+    enum eds_trace_stage stage;
+    uint64_t             since;
+};
+
+static inline uint64_t
+eds_trace_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline enum eds_trace_stage
+eds_trace_enter(struct eds_trace * const trace, const enum eds_trace_stage stage)
+{
+    const enum eds_trace_stage previous = trace->stage;
+    const uint64_t now = eds_trace_now();
+
+    if (trace->since)
+        trace->ns[previous] += now - trace->since;
+
+    trace->since = now;
+    trace->stage = stage;
+    trace->entries[stage]++;
+
+    return previous;
+}
+
+static inline void
+eds_trace_leave(struct eds_trace * const trace, const enum eds_trace_stage previous)
+{
+    const uint64_t now = eds_trace_now();
+
+    trace->ns[trace->stage] += now - trace->since;
+    trace->since = now;
+    trace->stage = previous;
+}
+
+#if defined(EDS_TRACE)
+#define EDS_TRACE_ENTER(trace, stage)                                           \
+    const enum eds_trace_stage eds_trace_previous_ =                            \
+        eds_trace_enter((trace), (stage))
+#define EDS_TRACE_LEAVE(trace)                                                  \
+    eds_trace_leave((trace), eds_trace_previous_)
+#define EDS_TRACE_COUNT(trace, counter)                                         \
+    ((void) ((trace)->counter++))
+#else
+#define EDS_TRACE_ENTER(trace, stage)   do { } while (0)
+#define EDS_TRACE_LEAVE(trace)          do { } while (0)
+#define EDS_TRACE_COUNT(trace, counter) do { } while (0)
+#endif
+
+/*! print the per-stage breakdown and the non-zero counters to \p stream */
+void
+eds_trace_write(const struct eds_trace *trace, FILE *stream);
+
+#endif
+
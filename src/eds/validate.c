@@ -0,0 +1,271 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "edid.h"
+#include "cea861.h"
+#include "validate.h"
+
+#define EDID_DESCRIPTORS_OFFSET                 (0x36)
+#define EDID_DESCRIPTOR_SIZE                    (0x12)
+
+static const char * const violation_names[] = {
+    [EDID_VIOLATION_TRUNCATED]          = "truncated",
+    [EDID_VIOLATION_HEADER]             = "header",
+    [EDID_VIOLATION_CHECKSUM]           = "checksum",
+    [EDID_VIOLATION_EXTENSION_COUNT]    = "extension count",
+    [EDID_VIOLATION_TRAILING_DATA]      = "trailing data",
+    [EDID_VIOLATION_VERSION]            = "version",
+    [EDID_VIOLATION_MANUFACTURER]       = "manufacturer",
+    [EDID_VIOLATION_RESERVED_BITS]      = "reserved bits",
+    [EDID_VIOLATION_DISPLAY_TYPE]       = "display type",
+    [EDID_VIOLATION_PREFERRED_TIMING]   = "preferred timing",
+    [EDID_VIOLATION_DESCRIPTOR_PADDING] = "descriptor padding",
+    [EDID_VIOLATION_DTD_OFFSET]         = "dtd offset",
+    [EDID_VIOLATION_DATA_BLOCK_OVERRUN] = "data block overrun",
+    [EDID_VIOLATION_BLOCK_PADDING]      = "block padding",
+};
+
+static inline uint32_t
+_report(struct edid_violation_log * const log,
+        const enum edid_violation violation, const uint8_t block,
+        const uint8_t offset)
+{
+    if (log) {
+        if (log->count < log->capacity) {
+            struct edid_violation_detail * const detail =
+                &log->details[log->count++];
+
+            detail->violation = violation;
+            detail->block = block;
+            detail->offset = offset;
+        } else {
+            log->dropped++;
+        }
+    }
+
+    return EDID_VIOLATION_MASK(violation);
+}
+
+static inline uint8_t
+_sum(const uint8_t * const block)
+{
+    uint8_t sum = 0;
+
+    for (uint8_t i = 0; i < EDID_BLOCK_SIZE; i++)
+        sum += block[i];
+
+    return sum;
+}
+
+static uint32_t
+_validate_monitor_descriptor(const uint8_t * const descriptor,
+                             const uint8_t offset, const uint8_t revision,
+                             struct edid_violation_log * const log)
+{
+    const uint8_t * const data = descriptor + 5;
+    uint8_t reserved = descriptor[4];
+    uint32_t violations = 0;
+    uint8_t i;
+
+    /*
+     * 1.4 defines the low nibble of the range limits flags as the +255 Hz/kHz
+     * rate offsets (per pair, 01b is reserved: a minimum beyond the maximum).
+     */
+    if (descriptor[3] == EDID_MONITOR_DESCRIPTOR_MONITOR_RANGE_LIMITS &&
+        revision >= 4)
+        reserved = (reserved & 0xf0) |
+                   ((reserved & 0x03) == 0x01) | ((reserved & 0x0c) == 0x04);
+
+    if (descriptor[2] || reserved)
+        violations |= _report(log, EDID_VIOLATION_RESERVED_BITS, 0, offset);
+
+    switch (descriptor[3]) {
+    case EDID_MONITOR_DESCRIPTOR_MONITOR_NAME:
+    case EDID_MONITOR_DESCRIPTOR_ASCII_STRING:
+    case EDID_MONITOR_DESCRIPTOR_MONITOR_SERIAL_NUMBER:
+        for (i = 0; i < 13 && data[i] != '\n'; i++)
+            ;
+        for (i = i + 1; i < 13; i++) {
+            if (data[i] != ' ') {
+                violations |= _report(log, EDID_VIOLATION_DESCRIPTOR_PADDING,
+                                      0, offset + 5 + i);
+                break;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    return violations;
+}
+
+static uint32_t
+_validate_base(const uint8_t * const block,
+               struct edid_violation_log * const log)
+{
+    const uint8_t version = block[0x12], revision = block[0x13];
+    const uint8_t input = block[0x14];
+    const uint8_t display_type = (block[0x18] >> 3) & 0x3;
+    const uint16_t manufacturer = (block[0x08] << 8) | block[0x09];
+    uint32_t violations = 0;
+
+    if (memcmp(block, EDID_HEADER, sizeof(EDID_HEADER)))
+        violations |= _report(log, EDID_VIOLATION_HEADER, 0, 0x00);
+
+    if (manufacturer & 0x8000)
+        violations |= _report(log, EDID_VIOLATION_RESERVED_BITS, 0, 0x08);
+    for (uint8_t shift = 0; shift < 15; shift += 5) {
+        const uint8_t letter = (manufacturer >> shift) & 0x1f;
+
+        if (letter == 0 || letter > 26) {
+            violations |= _report(log, EDID_VIOLATION_MANUFACTURER, 0, 0x08);
+            break;
+        }
+    }
+
+    if (version != 1)
+        violations |= _report(log, EDID_VIOLATION_VERSION, 0, 0x12);
+
+    /* prior to 1.4 only the DFP bit is defined for digital inputs */
+    if ((input & 0x80) && revision < 4 && (input & 0x7e))
+        violations |= _report(log, EDID_VIOLATION_RESERVED_BITS, 0, 0x14);
+
+    /* 1.4 redefines the field as the supported colour encodings for digital */
+    if (display_type == EDID_DISPLAY_TYPE_UNDEFINED &&
+        !(revision >= 4 && (input & 0x80)))
+        violations |= _report(log, EDID_VIOLATION_DISPLAY_TYPE, 0, 0x18);
+
+    for (uint8_t i = 0; i < 4; i++) {
+        const uint8_t offset = EDID_DESCRIPTORS_OFFSET + i * EDID_DESCRIPTOR_SIZE;
+        const uint8_t * const descriptor = block + offset;
+        const bool monitor = !descriptor[0] && !descriptor[1];
+
+        if (i == 0 && monitor && version == 1 && revision < 4)
+            violations |= _report(log, EDID_VIOLATION_PREFERRED_TIMING, 0, offset);
+
+        if (monitor)
+            violations |= _validate_monitor_descriptor(descriptor, offset, revision,
+                                                       log);
+    }
+
+    return violations;
+}
+
+static uint32_t
+_validate_cea861(const uint8_t * const block, const uint8_t index,
+                 struct edid_violation_log * const log)
+{
+    const uint8_t dof = offsetof(struct cea861_timing_block, data);
+    const uint8_t end = offsetof(struct cea861_timing_block, checksum);
+    const uint8_t dtd_offset = block[2];
+    uint32_t violations = 0;
+    uint8_t offset;
+
+    /* 0 indicates that there are neither data blocks nor DTDs */
+    if (dtd_offset == 0)
+        offset = dof;
+    else if (dtd_offset < dof || dtd_offset > end)
+        return _report(log, EDID_VIOLATION_DTD_OFFSET, index, 0x02);
+    else
+        offset = dtd_offset;
+
+    if (block[1] >= 3) {
+        for (uint8_t i = dof; i < offset; i += 1 + (block[i] & 0x1f)) {
+            if (i + 1 + (block[i] & 0x1f) > offset) {
+                violations |= _report(log, EDID_VIOLATION_DATA_BLOCK_OVERRUN,
+                                      index, i);
+                break;
+            }
+        }
+    }
+
+    if (dtd_offset == 0)
+        return violations;
+
+    while (offset + EDID_DESCRIPTOR_SIZE <= end && (block[offset] || block[offset + 1]))
+        offset = offset + EDID_DESCRIPTOR_SIZE;
+
+    for (; offset < end; offset++) {
+        if (block[offset]) {
+            violations |= _report(log, EDID_VIOLATION_BLOCK_PADDING, index, offset);
+            break;
+        }
+    }
+
+    return violations;
+}
+
+uint32_t
+edid_validate(const uint8_t * const data, const size_t length,
+              struct edid_violation_log * const log)
+{
+    const size_t available = length / EDID_BLOCK_SIZE;
+    uint32_t violations = 0;
+    size_t blocks;
+
+    if (log)
+        log->count = log->dropped = 0;
+
+    if (!available)
+        return _report(log, EDID_VIOLATION_TRUNCATED, 0, 0);
+
+    blocks = (size_t) data[0x7e] + 1;
+    if (blocks > available) {
+        violations |= _report(log, EDID_VIOLATION_EXTENSION_COUNT, 0, 0x7e);
+        blocks = available;
+    } else if (length > blocks * EDID_BLOCK_SIZE) {
+        violations |= _report(log, EDID_VIOLATION_TRAILING_DATA, 0, 0x7e);
+    }
+
+    for (size_t i = 0; i < blocks; i++) {
+        const uint8_t * const block = data + i * EDID_BLOCK_SIZE;
+
+        if (_sum(block))
+            violations |= _report(log, EDID_VIOLATION_CHECKSUM, i, 0x7f);
+
+        if (i == 0)
+            violations |= _validate_base(block, log);
+        else if (block[0] == EDID_EXTENSION_CEA)
+            violations |= _validate_cea861(block, i, log);
+    }
+
+    return violations;
+}
+
+const char *
+edid_violation_name(const enum edid_violation violation)
+{
+    if ((size_t) violation >= ARRAY_SIZE(violation_names))
+        return "unknown";
+    return violation_names[violation];
+}
@@ -0,0 +1,85 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_validate_h
+#define eds_validate_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum edid_violation {
+    EDID_VIOLATION_TRUNCATED,                   /* less than one block */
+    EDID_VIOLATION_HEADER,
+    EDID_VIOLATION_CHECKSUM,
+    EDID_VIOLATION_EXTENSION_COUNT,             /* extensions beyond the buffer */
+    EDID_VIOLATION_TRAILING_DATA,               /* buffer beyond the extensions */
+    EDID_VIOLATION_VERSION,
+    EDID_VIOLATION_MANUFACTURER,
+    EDID_VIOLATION_RESERVED_BITS,
+    EDID_VIOLATION_DISPLAY_TYPE,
+    EDID_VIOLATION_PREFERRED_TIMING,
+    EDID_VIOLATION_DESCRIPTOR_PADDING,
+    EDID_VIOLATION_DTD_OFFSET,
+    EDID_VIOLATION_DATA_BLOCK_OVERRUN,
+    EDID_VIOLATION_BLOCK_PADDING,
+};
+
+#define EDID_VIOLATION_MASK(violation)          (UINT32_C(1) << (violation))
+
+struct edid_violation_detail {
+    uint8_t  violation;                         /* enum edid_violation */
+    uint8_t  block;
+    uint8_t  offset;                            /* offset within the block */
+};
+
+/*!
+ * Optional caller owned storage for the individual violations.  Violations
+ * beyond the capacity are still reflected in the returned mask and counted in
+ * \p dropped.
+ */
+struct edid_violation_log {
+    struct edid_violation_detail *details;
+    size_t                       capacity;
+    size_t                       count;
+    size_t                       dropped;
+};
+
+/*!
+ * Check the base block and every extension, block by block, without
+ * allocating.  Returns a mask of EDID_VIOLATION_MASK bits, 0 for a conforming
+ * EDID.  \p log may be NULL.
+ */
+uint32_t
+edid_validate(const uint8_t *data, size_t length, struct edid_violation_log *log);
+
+const char *
+edid_violation_name(enum edid_violation violation);
+
+#endif
@@ -0,0 +1,98 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "edid.h"
+#include "cea861.h"
+#include "validate.h"
+#include "view.h"
+
+bool
+edid_view_init(struct edid_view * const view, const uint8_t * const data,
+               const size_t length)
+{
+    size_t blocks;
+
+    view->data = data;
+    view->blocks = 0;
+    view->violations = edid_validate(data, length, NULL);
+
+    if (length < EDID_BLOCK_SIZE || memcmp(data, EDID_HEADER, sizeof(EDID_HEADER)))
+        return false;
+
+    blocks = (size_t) edid_get_extensions(data) + 1;
+    if (blocks > length / EDID_BLOCK_SIZE)
+        blocks = length / EDID_BLOCK_SIZE;
+
+    view->data_blocks_end[0] = offsetof(struct cea861_timing_block, data);
+    view->dtds[0] = 0;
+
+    for (size_t i = 1; i < blocks; i++) {
+        const uint8_t * const block = data + i * EDID_BLOCK_SIZE;
+
+        if (block[0] == EDID_EXTENSION_CEA) {
+            cea861_layout((const struct cea861_timing_block *) block,
+                          &view->data_blocks_end[i], &view->dtds[i]);
+        } else {
+            view->data_blocks_end[i] = offsetof(struct cea861_timing_block, data);
+            view->dtds[i] = 0;
+        }
+    }
+
+    view->blocks = blocks;
+    return true;
+}
+
+void
+edid_view_visit(const struct edid_view * const view,
+                const struct edid_visitor * const visitor, void * const context)
+{
+    /* limited to the base block, which the view guarantees */
+    edid_visit(view->data, EDID_BLOCK_SIZE, visitor, context, NULL);
+
+    for (size_t i = 1; i < view->blocks; i++) {
+        const uint8_t * const block = view->data + i * EDID_BLOCK_SIZE;
+
+        switch (block[0]) {
+        case EDID_EXTENSION_CEA:
+            cea861_visit_layout((const struct cea861_timing_block *) block, i,
+                                view->data_blocks_end[i], view->dtds[i],
+                                visitor, context);
+            break;
+        default:
+            if (visitor->unknown_extension)
+                visitor->unknown_extension(context, i,
+                                           (const struct edid_extension *) block);
+            break;
+        }
+    }
+}
+
@@ -0,0 +1,133 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_view_h
+#define eds_view_h
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "edid.h"
+#include "cea861.h"
+
+#define EDID_VIEW_MAX_BLOCKS                    (0x100)
+
+/*!
+ * An EDID whose structure has been checked once by edid_view_init so that
+ * the accessors below need not check it again.  Only the blocks present in
+ * the buffer are included, and for each CEA-861 timing extension only the
+ * data blocks and DTDs which lie wholly within it.  Anything else which is
+ * wrong with the EDID is recorded in violations (edid_validate) but does not
+ * make the view unsafe to use.
+ */
+struct edid_view {
+    const uint8_t *data;
+    size_t        blocks;
+    uint32_t      violations;
+
+    /* as cea861_layout for CEA-861 timing extensions, empty otherwise */
+    uint8_t       data_blocks_end[EDID_VIEW_MAX_BLOCKS];
+    uint8_t       dtds[EDID_VIEW_MAX_BLOCKS];
+};
+
+/*!
+ * Build a view of the EDID in \p data.  Returns false if there is no base
+ * block with a valid header, in which case the view must not be used.
+ */
+bool
+edid_view_init(struct edid_view *view, const uint8_t *data, size_t length);
+
+/*! invoke \p visitor for every structure in the view */
+void
+edid_view_visit(const struct edid_view *view,
+                const struct edid_visitor *visitor, void *context);
+
+static inline const struct edid *
+edid_view_base(const struct edid_view * const view)
+{
+    return (const struct edid *) view->data;
+}
+
+static inline const uint8_t *
+edid_view_block(const struct edid_view * const view, const size_t block)
+{
+    assert(block < view->blocks);
+    return view->data + block * EDID_BLOCK_SIZE;
+}
+
+static inline uint8_t
+edid_view_tag(const struct edid_view * const view, const size_t block)
+{
+    return edid_view_block(view, block)[0];
+}
+
+/*!
+ * The data block collection of \p block, as [begin, end) offsets within it;
+ * successive headers are found by adding 1 + the length of each.
+ */
+static inline uint8_t
+edid_view_data_blocks_begin(const struct edid_view * const view,
+                            const size_t block)
+{
+    (void) view;
+    (void) block;
+    return offsetof(struct cea861_timing_block, data);
+}
+
+static inline uint8_t
+edid_view_data_blocks_end(const struct edid_view * const view,
+                          const size_t block)
+{
+    assert(block < view->blocks);
+    return view->data_blocks_end[block];
+}
+
+static inline uint8_t
+edid_view_dtd_count(const struct edid_view * const view, const size_t block)
+{
+    assert(block < view->blocks);
+    return view->dtds[block];
+}
+
+static inline const struct edid_detailed_timing_descriptor *
+edid_view_dtd(const struct edid_view * const view, const size_t block,
+              const uint8_t index)
+{
+    const uint8_t * const data = edid_view_block(view, block);
+
+    assert(index < view->dtds[block]);
+    return (const struct edid_detailed_timing_descriptor *)
+               (data + data[2] + index * sizeof(struct edid_detailed_timing_descriptor));
+}
+
+#endif
+
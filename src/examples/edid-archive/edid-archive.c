@@ -0,0 +1,168 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <eds/archive.h>
+#include <eds/bulk.h>
+
+struct state {
+    struct eds_archive_writer *writer;
+    const char * const        *paths;
+    size_t                    skipped;
+};
+
+static void
+add_edid(void * const context, const size_t index, const uint8_t * const data,
+         const ssize_t length)
+{
+    struct state * const state = context;
+
+    if (length < 0) {
+        fprintf(stderr, "unable to read %s: %s\n", state->paths[index],
+                strerror(-length));
+        state->skipped++;
+        return;
+    }
+
+    if (!eds_archive_writer_add(state->writer, data, length)) {
+        fprintf(stderr, "unable to add %s\n", state->paths[index]);
+        state->skipped++;
+    }
+}
+
+static char **
+read_paths(FILE * const stream, size_t * const count)
+{
+    char **paths = NULL, *line = NULL;
+    size_t capacity = 0, size = 0;
+    ssize_t length;
+
+    *count = 0;
+    while ((length = getline(&line, &size, stream)) >= 0) {
+        if (length && line[length - 1] == '\n')
+            line[--length] = '\0';
+        if (!length)
+            continue;
+
+        if (*count == capacity) {
+            char ** const resized =
+                realloc(paths, (capacity = capacity ? capacity << 1 : 1024) * sizeof(*paths));
+
+            if (!resized)
+                break;
+            paths = resized;
+        }
+
+        if ((paths[*count] = strdup(line)) == NULL)
+            break;
+        ++*count;
+    }
+
+    free(line);
+    return paths;
+}
+
+static void
+usage(const char * const name)
+{
+    printf("usage: %s <archive> [<edid data file> ...]\n", name);
+    printf("       paths are read from stdin when no file is given\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    struct state state = { NULL, NULL, 0 };
+    struct eds_bulk_reader *reader = NULL;
+    char **paths = NULL, **owned = NULL;
+    size_t count = 0;
+    int rv = EXIT_FAILURE, option, error;
+
+    while ((option = getopt(argc, argv, "h")) != -1) {
+        switch (option) {
+        case 'h':
+            usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind == argc) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (optind + 1 < argc) {
+        paths = &argv[optind + 1];
+        count = argc - optind - 1;
+    } else {
+        paths = owned = read_paths(stdin, &count);
+    }
+
+    if ((state.writer = eds_archive_writer_new()) == NULL ||
+        (reader = eds_bulk_reader_new(0, EDID_BLOCK_SIZE * 4)) == NULL) {
+        fprintf(stderr, "unable to allocate archive\n");
+        goto out;
+    }
+
+    state.paths = (const char * const *) paths;
+    if ((error = eds_bulk_read(reader, state.paths, count, add_edid, &state)) < 0) {
+        fprintf(stderr, "unable to read EDIDs: %s\n", strerror(-error));
+        goto out;
+    }
+
+    if ((error = eds_archive_writer_write(state.writer, argv[optind])) < 0) {
+        fprintf(stderr, "unable to write %s: %s\n", argv[optind],
+                strerror(-error));
+        goto out;
+    }
+
+    rv = state.skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+
+out:
+    eds_bulk_reader_free(reader);
+    eds_archive_writer_free(state.writer);
+
+    if (owned)
+        for (size_t i = 0; i < count; i++)
+            free(owned[i]);
+    free(owned);
+
+    return rv;
+}
+
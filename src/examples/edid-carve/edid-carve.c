@@ -0,0 +1,200 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <libgen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <eds/archive.h>
+#include <eds/carve.h>
+#include <eds/edid.h>
+
+struct state {
+    const char                *path;
+    const char                *directory;
+    struct eds_archive_writer *writer;
+    int                       rv;
+};
+
+static void
+write_edid(struct state * const state, const size_t offset,
+           const uint8_t * const data, const size_t length)
+{
+    char *path = NULL, *name = NULL;
+    FILE *stream = NULL;
+
+    if ((name = strdup(state->path)) == NULL ||
+        asprintf(&path, "%s/%s@%#zx.bin", state->directory, basename(name),
+                 offset) < 0) {
+        path = NULL;
+        fprintf(stderr, "unable to allocate path\n");
+        goto error;
+    }
+
+    if ((stream = fopen(path, "wb")) == NULL ||
+        fwrite(data, 1, length, stream) != length) {
+        fprintf(stderr, "unable to write %s: %s\n", path, strerror(errno));
+        goto error;
+    }
+
+    goto out;
+
+error:
+    state->rv = EXIT_FAILURE;
+out:
+    if (stream)
+        fclose(stream);
+    free(path);
+    free(name);
+}
+
+static void
+found_edid(void * const context, const size_t offset,
+           const uint8_t * const data, const size_t length)
+{
+    struct state * const state = context;
+    char manufacturer[4];
+
+    edid_manufacturer((const struct edid *) data, manufacturer);
+    printf("%s: %#010zx %3zu blocks %s %04x\n", state->path, offset,
+           length / EDID_BLOCK_SIZE, manufacturer, edid_get_product(data));
+
+    if (state->directory)
+        write_edid(state, offset, data, length);
+
+    if (state->writer && !eds_archive_writer_add(state->writer, data, length)) {
+        fprintf(stderr, "unable to add the EDID at %s:%#zx\n", state->path,
+                offset);
+        state->rv = EXIT_FAILURE;
+    }
+}
+
+static int
+carve_file(struct state * const state)
+{
+    struct stat st;
+    void *mapping;
+    int fd;
+
+    if ((fd = open(state->path, O_RDONLY | O_CLOEXEC)) < 0 || fstat(fd, &st) < 0) {
+        fprintf(stderr, "unable to open %s: %s\n", state->path, strerror(errno));
+        if (fd >= 0)
+            close(fd);
+        return EXIT_FAILURE;
+    }
+
+    if (st.st_size < EDID_BLOCK_SIZE) {
+        close(fd);
+        return EXIT_SUCCESS;
+    }
+
+    mapping = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "unable to map %s: %s\n", state->path, strerror(errno));
+        return EXIT_FAILURE;
+    }
+
+    /* a single forward pass; let the kernel read ahead aggressively */
+    madvise(mapping, st.st_size, MADV_SEQUENTIAL);
+
+    eds_carve(mapping, st.st_size, found_edid, state);
+
+    munmap(mapping, st.st_size);
+    return EXIT_SUCCESS;
+}
+
+static void
+usage(const char * const name)
+{
+    printf("usage: %s [-o directory] [-a archive] <file> ...\n", name);
+    printf("       -o  write each EDID found to <directory>/<file>@<offset>.bin\n");
+    printf("       -a  collect the EDIDs found into an archive\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    struct state state = { NULL, NULL, NULL, EXIT_SUCCESS };
+    const char *archive = NULL;
+    int option, error;
+
+    while ((option = getopt(argc, argv, "a:o:h")) != -1) {
+        switch (option) {
+        case 'a':
+            archive = optarg;
+            break;
+        case 'o':
+            state.directory = optarg;
+            break;
+        case 'h':
+            usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind == argc) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (archive && (state.writer = eds_archive_writer_new()) == NULL) {
+        fprintf(stderr, "unable to allocate archive\n");
+        return EXIT_FAILURE;
+    }
+
+    for (int i = optind; i < argc; i++) {
+        state.path = argv[i];
+        if (carve_file(&state) != EXIT_SUCCESS)
+            state.rv = EXIT_FAILURE;
+    }
+
+    if (archive && (error = eds_archive_writer_write(state.writer, archive)) < 0) {
+        fprintf(stderr, "unable to write %s: %s\n", archive, strerror(-error));
+        state.rv = EXIT_FAILURE;
+    }
+
+    eds_archive_writer_free(state.writer);
+    return state.rv;
+}
+
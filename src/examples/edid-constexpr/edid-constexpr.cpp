@@ -0,0 +1,84 @@
+/* vim: set et fde fdm=syntax ft=cpp.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <eds/edid.hpp>
+
+/*
+ * An EDID baked into the image.  It is validated and decoded entirely at
+ * compile time; a corrupted byte fails the build rather than the boot.
+ */
+static constexpr std::array<std::uint8_t, 256> panel = {
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x10, 0xac, 0x7a, 0x40, 0x4c, 0x32, 0x30, 0x41,
+    0x14, 0x1c, 0x01, 0x03, 0x80, 0x3c, 0x22, 0x78, 0x2a, 0xee, 0x95, 0xa3, 0x54, 0x4c, 0x99, 0x26,
+    0x0f, 0x50, 0x54, 0xa5, 0x4b, 0x00, 0x71, 0x4f, 0x81, 0x80, 0xa9, 0xc0, 0xd1, 0xc0, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x3a, 0x80, 0x18, 0x71, 0x38, 0x2d, 0x40, 0x58, 0x2c,
+    0x45, 0x00, 0x13, 0x2b, 0x21, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xff, 0x00, 0x41, 0x42, 0x43,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x44,
+    0x45, 0x4c, 0x4c, 0x20, 0x55, 0x32, 0x34, 0x31, 0x32, 0x4d, 0x0a, 0x20, 0x00, 0x00, 0x00, 0xfd,
+    0x00, 0x32, 0x4c, 0x1e, 0x53, 0x11, 0x00, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x01, 0xd4,
+    0x02, 0x03, 0x27, 0xf1, 0x47, 0x90, 0x04, 0x1f, 0x13, 0x02, 0x03, 0x61, 0x29, 0x09, 0x07, 0x07,
+    0x15, 0x07, 0x50, 0x3d, 0x1e, 0xc0, 0x83, 0x0f, 0x00, 0x00, 0x6c, 0x03, 0x0c, 0x00, 0x10, 0x00,
+    0xb8, 0x44, 0xa0, 0x0b, 0x0b, 0x00, 0x00, 0x01, 0x1d, 0x00, 0x72, 0x51, 0xd0, 0x1e, 0x20, 0x6e,
+    0x28, 0x55, 0x00, 0x13, 0x2b, 0x21, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83,
+};
+
+static constexpr eds::info info = eds::decode(panel);
+
+static_assert(info, "malformed EDID");
+static_assert(info.modes > 0 && info.mode[0].preferred,
+              "EDID does not declare a preferred timing");
+static_assert(eds::vic_lookup(16)->hactive == 1920,
+              "unexpected timing for VIC 16");
+
+int
+main()
+{
+    std::printf("%s %04x \"%s\"\n", info.manufacturer.data(), info.product,
+                info.name.data());
+
+    for (std::size_t i = 0; i < info.modes; i++) {
+        const eds::mode &mode = info.mode[i];
+
+        std::printf("  %4u x %4u%c @ %u.%03u Hz%s\n",
+                    mode.hactive, mode.vactive, mode.interlaced ? 'i' : 'p',
+                    mode.refresh / 1000, mode.refresh % 1000,
+                    mode.preferred ? " (preferred)" : "");
+    }
+
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,313 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <getopt.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <eds/archive.h>
+#include <eds/bulk.h>
+#include <eds/edid.h>
+#include <eds/query.h>
+
+struct worker {
+    pthread_t                thread;
+    bool                     started;
+    const struct eds_query   *query;
+
+    /* either a share of the paths or of the archive's records */
+    char * const             *paths;
+    const struct eds_archive *archive;
+    size_t                   first;
+    size_t                   count;
+
+    size_t                   *matches;
+    size_t                   matched;
+    size_t                   capacity;
+    bool                     failed;
+};
+
+static void
+add_match(struct worker * const worker, const size_t index)
+{
+    if (worker->matched == worker->capacity) {
+        const size_t capacity = worker->capacity ? worker->capacity << 1 : 256;
+        size_t * const matches =
+            realloc(worker->matches, capacity * sizeof(*matches));
+
+        if (!matches) {
+            worker->failed = true;
+            return;
+        }
+
+        worker->matches = matches;
+        worker->capacity = capacity;
+    }
+
+    worker->matches[worker->matched++] = index;
+}
+
+static void
+match_edid(void * const context, const size_t index, const uint8_t * const data,
+           const ssize_t length)
+{
+    struct worker * const worker = context;
+
+    if (length < 0) {
+        fprintf(stderr, "unable to read %s: %s\n", worker->paths[index],
+                strerror(-length));
+        return;
+    }
+
+    if (eds_query_match(worker->query, data, length))
+        add_match(worker, worker->first + index);
+}
+
+static void *
+process(void * const context)
+{
+    struct worker * const worker = context;
+    struct eds_bulk_reader *reader;
+    int rv;
+
+    if (worker->archive) {
+        uint8_t buffer[EDID_BLOCK_SIZE * 256];
+
+        for (size_t i = worker->first; i < worker->first + worker->count; i++) {
+            const size_t length =
+                eds_archive_copy(worker->archive, i, buffer, sizeof(buffer));
+
+            if (length && eds_query_match(worker->query, buffer, length))
+                add_match(worker, i);
+        }
+
+        return NULL;
+    }
+
+    /* nearly every EDID fits in four blocks; larger ones are read again */
+    if ((reader = eds_bulk_reader_new(0, EDID_BLOCK_SIZE * 4)) == NULL) {
+        fprintf(stderr, "unable to allocate reader\n");
+        worker->failed = true;
+        return NULL;
+    }
+
+    if ((rv = eds_bulk_read(reader, (const char * const *) worker->paths,
+                            worker->count, match_edid, worker)) < 0)
+        fprintf(stderr, "unable to read EDIDs: %s\n", strerror(-rv));
+
+    eds_bulk_reader_free(reader);
+    return NULL;
+}
+
+static char **
+read_paths(FILE * const stream, size_t * const count)
+{
+    char **paths = NULL, *line = NULL;
+    size_t capacity = 0, size = 0;
+    ssize_t length;
+
+    *count = 0;
+    while ((length = getline(&line, &size, stream)) >= 0) {
+        if (length && line[length - 1] == '\n')
+            line[--length] = '\0';
+        if (!length)
+            continue;
+
+        if (*count == capacity) {
+            char ** const resized =
+                realloc(paths, (capacity = capacity ? capacity << 1 : 1024) * sizeof(*paths));
+
+            if (!resized)
+                break;
+            paths = resized;
+        }
+
+        if ((paths[*count] = strdup(line)) == NULL)
+            break;
+        ++*count;
+    }
+
+    free(line);
+    return paths;
+}
+
+static void
+usage(const char * const name)
+{
+    printf("usage: %s [-j jobs] [-c] [-a archive] <expression> [<edid data file> ...]\n", name);
+    printf("       paths are read from stdin when neither a file nor an archive is given\n");
+    printf("fields:");
+    for (const char * const *field = eds_query_fields(); *field; field++)
+        printf(" %s", *field);
+    printf("\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    const char *archive_path = NULL;
+    struct eds_archive *archive = NULL;
+    struct eds_query *query = NULL;
+    struct worker *workers = NULL;
+    char **paths = NULL, **owned = NULL;
+    size_t count = 0, matched = 0;
+    bool count_only = false;
+    char error[128];
+    int rv = EXIT_FAILURE, option;
+
+    while ((option = getopt(argc, argv, "a:cj:h")) != -1) {
+        switch (option) {
+        case 'a':
+            archive_path = optarg;
+            break;
+        case 'c':
+            count_only = true;
+            break;
+        case 'j':
+            jobs = strtol(optarg, NULL, 10);
+            break;
+        case 'h':
+            usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if ((query = eds_query_compile(argv[optind++], error, sizeof(error))) == NULL) {
+        fprintf(stderr, "invalid expression: %s\n", error);
+        return EXIT_FAILURE;
+    }
+
+    if (jobs < 1)
+        jobs = 1;
+
+    if (archive_path) {
+        if ((archive = eds_archive_open(archive_path)) == NULL) {
+            fprintf(stderr, "unable to open archive %s\n", archive_path);
+            goto out;
+        }
+        count = eds_archive_count(archive);
+    } else if (optind < argc) {
+        paths = &argv[optind];
+        count = argc - optind;
+    } else {
+        paths = owned = read_paths(stdin, &count);
+    }
+
+    if ((size_t) jobs > count && count)
+        jobs = count;
+
+    if ((workers = calloc(jobs, sizeof(*workers))) == NULL) {
+        fprintf(stderr, "unable to allocate workers\n");
+        goto out;
+    }
+
+    for (long i = 0; i < jobs; i++) {
+        const size_t share = (count + jobs - 1) / jobs;
+        const size_t first = share * i < count ? share * i : count;
+
+        workers[i].query = query;
+        workers[i].archive = archive;
+        workers[i].paths = paths ? paths + first : NULL;
+        workers[i].first = first;
+        workers[i].count = first + share < count ? share : count - first;
+    }
+
+    for (long i = 1; i < jobs; i++) {
+        if (pthread_create(&workers[i].thread, NULL, process, &workers[i])) {
+            fprintf(stderr, "unable to create worker thread\n");
+            break;
+        }
+        workers[i].started = true;
+    }
+
+    process(&workers[0]);
+
+    for (long i = 1; i < jobs; i++) {
+        if (workers[i].started)
+            pthread_join(workers[i].thread, NULL);
+        else
+            process(&workers[i]);
+    }
+
+    /* shares are contiguous, so printing them in turn preserves the order */
+    for (long i = 0; i < jobs; i++) {
+        if (workers[i].failed) {
+            fprintf(stderr, "unable to record matches\n");
+            goto out;
+        }
+
+        matched += workers[i].matched;
+        if (count_only)
+            continue;
+
+        for (size_t j = 0; j < workers[i].matched; j++) {
+            if (archive)
+                printf("%s:%zu\n", archive_path, workers[i].matches[j]);
+            else
+                printf("%s\n", paths[workers[i].matches[j]]);
+        }
+    }
+
+    if (count_only)
+        printf("%zu\n", matched);
+
+    rv = matched ? EXIT_SUCCESS : EXIT_FAILURE;
+
+out:
+    if (workers)
+        for (long i = 0; i < jobs; i++)
+            free(workers[i].matches);
+    free(workers);
+
+    if (owned)
+        for (size_t i = 0; i < count; i++)
+            free(owned[i]);
+    free(owned);
+
+    if (archive)
+        eds_archive_close(archive);
+    eds_query_free(query);
+
+    return rv;
+}
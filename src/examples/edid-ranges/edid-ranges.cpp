@@ -0,0 +1,96 @@
+/* vim: set et fde fdm=syntax ft=cpp.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <ranges>
+#include <vector>
+
+#include <eds/ranges.hpp>
+
+static void
+list(std::span<const std::uint8_t> edid)
+{
+    for (const eds::detailed_timing dtd : eds::detailed_timings(edid))
+        std::printf("DTD  %4u x %4u%c %u kHz\n", dtd.hactive(), dtd.vactive(),
+                    dtd.interlaced() ? 'i' : 'p', dtd.pixel_clock());
+
+    for (const eds::standard_timing std : eds::standard_timings(edid))
+        std::printf("STD  %4u x %4u @ %uHz\n", std.hactive(), std.vactive(),
+                    std.refresh());
+
+    for (const std::span<const std::uint8_t> block : eds::blocks(edid) | std::views::drop(1)) {
+        auto blocks = eds::data_blocks(block);
+
+        for (const eds::short_video_descriptor svd : blocks
+                | std::views::transform(eds::short_video_descriptors)
+                | std::views::join
+                | std::views::filter([](eds::short_video_descriptor svd) { return svd.timing(); }))
+            std::printf("VIC  %3u%s %4u x %4u\n", svd.vic(), svd.native() ? "*" : " ",
+                        svd.timing()->hactive, svd.timing()->vactive);
+
+        for (const unsigned channels : blocks
+                | std::views::transform(eds::short_audio_descriptors)
+                | std::views::join
+                | std::views::transform(&eds::short_audio_descriptor::channels))
+            std::printf("SAD  %u-channel\n", channels);
+
+        for (const eds::detailed_timing dtd : eds::cea861_detailed_timings(block))
+            std::printf("DTD  %4u x %4u%c %u kHz\n", dtd.hactive(), dtd.vactive(),
+                        dtd.interlaced() ? 'i' : 'p', dtd.pixel_clock());
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    std::vector<std::uint8_t> buffer;
+    std::FILE *edid;
+    int c;
+
+    if (argc != 2) {
+        std::printf("usage: %s <edid data file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if ((edid = std::fopen(argv[1], "rb")) == nullptr) {
+        std::fprintf(stderr, "unable to open EDID data: %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    while ((c = std::fgetc(edid)) != EOF)
+        buffer.push_back(static_cast<std::uint8_t>(c));
+    std::fclose(edid);
+
+    list(buffer);
+
+    return EXIT_SUCCESS;
+}
+
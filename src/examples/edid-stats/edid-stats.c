@@ -0,0 +1,233 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <getopt.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <eds/bulk.h>
+#include <eds/edid.h>
+#include <eds/stats.h>
+
+struct worker {
+    pthread_t         thread;
+    bool              started;
+    struct eds_stats  *stats;
+
+    char * const      *paths;
+    size_t            count;
+};
+
+static void
+add_edid(void * const context, const size_t index, const uint8_t * const data,
+         const ssize_t length)
+{
+    struct worker * const worker = context;
+
+    if (length < 0) {
+        fprintf(stderr, "unable to read %s: %s\n", worker->paths[index],
+                strerror(-length));
+        return;
+    }
+
+    eds_stats_add(worker->stats, data, length);
+}
+
+static void *
+process(void * const context)
+{
+    struct worker * const worker = context;
+    struct eds_bulk_reader *reader;
+    int rv;
+
+    /* nearly every EDID fits in four blocks; larger ones are read again */
+    if ((reader = eds_bulk_reader_new(0, EDID_BLOCK_SIZE * 4)) == NULL) {
+        fprintf(stderr, "unable to allocate reader\n");
+        return NULL;
+    }
+
+    if ((rv = eds_bulk_read(reader, (const char * const *) worker->paths,
+                            worker->count, add_edid, worker)) < 0)
+        fprintf(stderr, "unable to read EDIDs: %s\n", strerror(-rv));
+
+    eds_bulk_reader_free(reader);
+    return NULL;
+}
+
+static char **
+read_paths(FILE * const stream, size_t * const count)
+{
+    char **paths = NULL, *line = NULL;
+    size_t capacity = 0, size = 0;
+    ssize_t length;
+
+    *count = 0;
+    while ((length = getline(&line, &size, stream)) >= 0) {
+        if (length && line[length - 1] == '\n')
+            line[--length] = '\0';
+        if (!length)
+            continue;
+
+        if (*count == capacity) {
+            char ** const resized =
+                realloc(paths, (capacity = capacity ? capacity << 1 : 1024) * sizeof(*paths));
+
+            if (!resized)
+                break;
+            paths = resized;
+        }
+
+        if ((paths[*count] = strdup(line)) == NULL)
+            break;
+        ++*count;
+    }
+
+    free(line);
+    return paths;
+}
+
+static void
+usage(const char * const name)
+{
+    printf("usage: %s [-j jobs] [-f csv|json] [<edid data file> ...]\n", name);
+    printf("       paths are read from stdin when no file is given\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    enum eds_stats_format format = EDS_STATS_FORMAT_CSV;
+    long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    struct worker *workers = NULL;
+    char **paths = NULL, **owned = NULL;
+    size_t count = 0;
+    int rv = EXIT_FAILURE, option;
+
+    while ((option = getopt(argc, argv, "f:j:h")) != -1) {
+        switch (option) {
+        case 'f':
+            if (!strcmp(optarg, "csv")) {
+                format = EDS_STATS_FORMAT_CSV;
+            } else if (!strcmp(optarg, "json")) {
+                format = EDS_STATS_FORMAT_JSON;
+            } else {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'j':
+            jobs = strtol(optarg, NULL, 10);
+            break;
+        case 'h':
+            usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (jobs < 1)
+        jobs = 1;
+
+    if (optind < argc) {
+        paths = &argv[optind];
+        count = argc - optind;
+    } else {
+        paths = owned = read_paths(stdin, &count);
+    }
+
+    if ((size_t) jobs > count && count)
+        jobs = count;
+
+    if ((workers = calloc(jobs, sizeof(*workers))) == NULL) {
+        fprintf(stderr, "unable to allocate workers\n");
+        goto out;
+    }
+
+    for (long i = 0; i < jobs; i++) {
+        const size_t share = (count + jobs - 1) / jobs;
+        const size_t first = share * i < count ? share * i : count;
+
+        workers[i].paths = paths + first;
+        workers[i].count = first + share < count ? share : count - first;
+
+        if ((workers[i].stats = eds_stats_new()) == NULL) {
+            fprintf(stderr, "unable to allocate statistics\n");
+            goto out;
+        }
+    }
+
+    for (long i = 1; i < jobs; i++) {
+        if (pthread_create(&workers[i].thread, NULL, process, &workers[i])) {
+            fprintf(stderr, "unable to create worker thread\n");
+            break;
+        }
+        workers[i].started = true;
+    }
+
+    process(&workers[0]);
+
+    /* every worker must be done before any statistics may be freed */
+    for (long i = 1; i < jobs; i++) {
+        if (workers[i].started)
+            pthread_join(workers[i].thread, NULL);
+        else
+            process(&workers[i]);
+    }
+
+    for (long i = 1; i < jobs; i++) {
+        if (!eds_stats_merge(workers[0].stats, workers[i].stats)) {
+            fprintf(stderr, "unable to merge statistics\n");
+            goto out;
+        }
+    }
+
+    eds_stats_write(workers[0].stats, format, stdout);
+    rv = EXIT_SUCCESS;
+
+out:
+    if (workers)
+        for (long i = 0; i < jobs; i++)
+            eds_stats_free(workers[i].stats);
+    free(workers);
+
+    if (owned)
+        for (size_t i = 0; i < count; i++)
+            free(owned[i]);
+    free(owned);
+
+    return rv;
+}
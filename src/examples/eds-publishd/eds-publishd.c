@@ -0,0 +1,203 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <eds/publish.h>
+#include <eds/sysfs.h>
+
+static volatile sig_atomic_t done;
+
+static void
+terminate(int signal)
+{
+    (void) signal;
+    done = 1;
+}
+
+static void
+publish(struct eds_publisher * const publisher,
+        const struct eds_sysfs_scanner * const scanner)
+{
+    const size_t count = eds_sysfs_scanner_count(scanner);
+
+    for (size_t i = 0; i < count; i++) {
+        const struct eds_sysfs_connector * const connector =
+            eds_sysfs_scanner_connector(scanner, i);
+
+        if (i >= EDS_PUBLISH_SLOTS) {
+            fprintf(stderr, "no slot for connector %s\n", connector->name);
+            continue;
+        }
+
+        eds_publisher_update(publisher, i, connector->name,
+                             connector->connected ? connector->edid : NULL,
+                             connector->length,
+                             connector->valid ? &connector->info : NULL);
+    }
+
+    for (size_t i = count; i < EDS_PUBLISH_SLOTS; i++)
+        eds_publisher_clear(publisher, i);
+}
+
+static int
+list(const char * const name)
+{
+    struct eds_publication publication;
+    struct eds_subscriber *subscriber;
+
+    if (!(subscriber = eds_subscriber_new(name))) {
+        fprintf(stderr, "unable to map %s\n", name ? name : EDS_PUBLISH_DEFAULT_NAME);
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < EDS_PUBLISH_SLOTS; i++) {
+        const uint32_t sequence = eds_subscriber_read(subscriber, i, &publication);
+
+        if (!sequence || !publication.connector[0])
+            continue;
+
+        printf("%2zu %-24s %-12s", i, publication.connector,
+               publication.connected ? "connected" : "disconnected");
+        if (publication.valid)
+            printf(" %s %04x %s", publication.info.manufacturer,
+                   publication.info.product, publication.info.name);
+        printf("\n");
+    }
+
+    eds_subscriber_free(subscriber);
+    return EXIT_SUCCESS;
+}
+
+static void
+usage(const char * const name)
+{
+    printf("usage: %s [-r sysfs root] [-n shm name] [-i interval] [-l]\n", name);
+    printf("       -l lists the published connectors instead of publishing\n");
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *root = NULL, *name = NULL;
+    struct eds_sysfs_scanner *scanner = NULL;
+    struct eds_publisher *publisher = NULL;
+    struct sigaction action;
+    long interval = 1;
+    bool listing = false;
+    int rv = EXIT_FAILURE, option;
+
+    while ((option = getopt(argc, argv, "r:n:i:lh")) != -1) {
+        switch (option) {
+        case 'r':
+            root = optarg;
+            break;
+        case 'n':
+            name = optarg;
+            break;
+        case 'i':
+            interval = strtol(optarg, NULL, 10);
+            break;
+        case 'l':
+            listing = true;
+            break;
+        case 'h':
+            usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (listing)
+        return list(name);
+
+    if (interval < 1)
+        interval = 1;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = terminate;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    if (!(scanner = eds_sysfs_scanner_new(root))) {
+        fprintf(stderr, "unable to scan %s\n", root ? root : "/sys");
+        goto out;
+    }
+
+    if (!(publisher = eds_publisher_new(name))) {
+        fprintf(stderr, "unable to create %s: %s\n",
+                name ? name : EDS_PUBLISH_DEFAULT_NAME, strerror(errno));
+        goto out;
+    }
+
+    publish(publisher, scanner);
+
+    /*
+     * Wait for uevents when they are available; otherwise (and as a fallback
+     * for drivers which do not send them) poll the connector status.
+     */
+    while (!done) {
+        struct pollfd pfd = { .fd = eds_sysfs_scanner_fd(scanner), .events = POLLIN };
+        int changed;
+
+        if (poll(&pfd, pfd.fd < 0 ? 0 : 1, interval * 1000) < 0) {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "poll: %s\n", strerror(errno));
+            goto out;
+        }
+
+        if (pfd.revents & POLLIN)
+            changed = eds_sysfs_scanner_dispatch(scanner);
+        else
+            changed = eds_sysfs_scanner_check_status(scanner);
+
+        if (changed > 0)
+            publish(publisher, scanner);
+    }
+
+    rv = EXIT_SUCCESS;
+
+out:
+    eds_publisher_free(publisher);
+    eds_sysfs_scanner_free(scanner);
+    return rv;
+}
+
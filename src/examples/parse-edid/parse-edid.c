@@ -30,21 +30,35 @@
 
 #define _GNU_SOURCE
 
+#include <getopt.h>
 #include <math.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <eds/edid.h>
+#include <eds/archive.h>
+#include <eds/audio.h>
+#include <eds/bulk.h>
 #include <eds/hdmi.h>
 #include <eds/cea861.h>
+#include <eds/extension.h>
+#include <eds/input.h>
+#include <eds/trace.h>
+#include <eds/validate.h>
+#include <eds/view.h>
 
 #define CM_2_MM(cm)                             ((cm) * 10)
 #define CM_2_IN(cm)                             ((cm) * 0.3937)
 
 #define HZ_2_MHZ(hz)                            ((hz) / 1000000)
 
+#if defined(EDS_TRACE)
+static struct eds_trace trace;
+#endif
+
 
 static inline void
 dump_section(const char * const name,
@@ -56,6 +70,8 @@ dump_section(const char * const name,
 
     const uint8_t *value = buffer + offset;
 
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_FORMAT);
+
     printf("%33.33s: ", name);
 
     for (uint8_t i = 0, l = 35; i < length; i++) {
@@ -67,11 +83,15 @@ dump_section(const char * const name,
     }
 
     printf("\b\n");
+
+    EDS_TRACE_LEAVE(&trace);
 }
 
 static void
 dump_edid1(const uint8_t * const buffer)
 {
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_BASE);
+
     dump_section("header",                            buffer, 0x00, 0x08);
     dump_section("vendor/product identification",     buffer, 0x08, 0x0a);
     dump_section("edid struct version/revision",      buffer, 0x12, 0x02);
@@ -87,35 +107,47 @@ dump_edid1(const uint8_t * const buffer)
     dump_section("checksum",                          buffer, 0x7f, 0x01);
 
     printf("\n");
+
+    EDS_TRACE_LEAVE(&trace);
 }
 
 static void
-dump_cea861(const uint8_t * const buffer)
+dump_cea861(const struct edid_view * const view, const uint8_t block)
 {
-    const struct edid_detailed_timing_descriptor *dtd = NULL;
+    const uint8_t * const buffer = edid_view_block(view, block);
     const struct cea861_timing_block * const ctb =
         (struct cea861_timing_block *) buffer;
     const uint8_t dof = offsetof(struct cea861_timing_block, data);
+    const uint8_t dtds = edid_view_dtd_count(view, block);
+    uint8_t end = dof;
+
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_CEA861);
 
     dump_section("cea extension header",  buffer, 0x00, 0x04);
 
-    if (ctb->dtd_offset - dof)
+    if (ctb->dtd_offset > dof && ctb->dtd_offset < EDID_BLOCK_SIZE - 1) {
         dump_section("data block collection", buffer, 0x04, ctb->dtd_offset - dof);
+        end = ctb->dtd_offset;
+    }
 
-    dtd = (struct edid_detailed_timing_descriptor *) (buffer + ctb->dtd_offset);
-    for (uint8_t i = 0; dtd->pixel_clock; i++, dtd++) {
+    for (uint8_t i = 0; i < dtds; i++) {
+        const struct edid_detailed_timing_descriptor * const dtd =
+            edid_view_dtd(view, block, i);
         char *header = NULL;
 
         asprintf(&header, "detailed timing descriptor %03u", i);
         dump_section(header, (uint8_t *) dtd, 0x00, sizeof(*dtd));
         free(header);
+
+        end = (uint8_t *) (dtd + 1) - buffer;
     }
 
-    dump_section("padding",  buffer, (uint8_t *) dtd - buffer,
-                 dof + sizeof(ctb->data) - ((uint8_t *) dtd - buffer));
+    dump_section("padding",  buffer, end, dof + sizeof(ctb->data) - end);
     dump_section("checksum", buffer, 0x7f, 0x01);
 
     printf("\n");
+
+    EDS_TRACE_LEAVE(&trace);
 }
 
 
@@ -147,6 +179,8 @@ _edid_timing_string(const struct edid_detailed_timing_descriptor * const dtb)
     const uint32_t htotal = hres + edid_detailed_timing_horizontal_blanking(dtb);
     const uint32_t vtotal = vres + edid_detailed_timing_vertical_blanking(dtb);
 
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_FORMAT);
+
     asprintf(&timing,
              "%ux%u%c at %.fHz (%s)",
              hres,
@@ -155,6 +189,8 @@ _edid_timing_string(const struct edid_detailed_timing_descriptor * const dtb)
              (double) edid_detailed_timing_pixel_clock(dtb) / (vtotal * htotal),
              _aspect_ratio(hres, vres));
 
+    EDS_TRACE_LEAVE(&trace);
+
     return timing;
 }
 
@@ -168,6 +204,8 @@ _edid_mode_string(const struct edid_detailed_timing_descriptor * const dtb)
     const uint16_t lower_margin = edid_detailed_timing_vertical_sync_offset(dtb);
     const uint16_t right_margin = edid_detailed_timing_horizontal_sync_offset(dtb);
 
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_FORMAT);
+
     asprintf(&modestr,
              "\"%ux%u\" %.3f %u %u %u %u %u %u %u %u %chsync %cvsync",
              /* resolution */
@@ -192,6 +230,8 @@ _edid_mode_string(const struct edid_detailed_timing_descriptor * const dtb)
              dtb->signal_pulse_polarity ? '+' : '-',
              dtb->signal_serration_polarity ? '+' : '-');
 
+    EDS_TRACE_LEAVE(&trace);
+
     return modestr;
 }
 
@@ -216,6 +256,8 @@ disp_edid1(const struct edid * const edid)
         [EDID_DISPLAY_TYPE_UNDEFINED]  = "Undefined",
     };
 
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_BASE);
+
     edid_manufacturer(edid, manufacturer);
     characteristics = edid_color_characteristics(edid);
 
@@ -248,6 +290,7 @@ disp_edid1(const struct edid * const edid)
             *strchrnul(monitor_serial_number, '\n') = '\0';
             break;
         default:
+            EDS_TRACE_COUNT(&trace, unknown_monitor_descriptor[mon->tag]);
             fprintf(stderr, "unknown monitor descriptor type 0x%02x\n",
                     mon->tag);
             break;
@@ -263,11 +306,11 @@ disp_edid1(const struct edid * const edid)
            manufacturer);
 
     printf("  Product code............. %u\n",
-           *(uint16_t *) edid->product);
+           edid_get_product((const uint8_t *) edid));
 
-    if (*(uint32_t *) edid->serial_number)
+    if (edid_get_serial_number((const uint8_t *) edid))
         printf("  Module serial number..... %u\n",
-               *(uint32_t *) edid->serial_number);
+               edid_get_serial_number((const uint8_t *) edid));
 
 #if defined(DISPLAY_UNKNOWN)
     printf("  Plug and Play ID......... %s\n", NULL);
@@ -471,85 +514,155 @@ disp_edid1(const struct edid * const edid)
     }
 
     printf("\n");
+
+    EDS_TRACE_LEAVE(&trace);
 }
 
 
 /* CEA861 routines */
-/*! \todo move to cea861.c */
 
-static inline void
-disp_cea861_audio_data(const struct cea861_audio_data_block * const adb)
+struct disp_cea861_state {
+    uint8_t dtds;
+    bool    section;
+};
+
+static void
+disp_cea861_detailed_timing(void *context, uint8_t block,
+                            const struct edid_detailed_timing_descriptor *dtd)
 {
-    const uint8_t descriptors = adb->header.length / sizeof(*adb->sad);
-
-    printf("CE audio data (formats supported)\n");
-    for (uint8_t i = 0; i < descriptors; i++) {
-        const struct cea861_short_audio_descriptor * const sad =
-            (struct cea861_short_audio_descriptor *) &adb->sad[i];
-
-        switch (sad->audio_format) {
-        case CEA861_AUDIO_FORMAT_LPCM:
-            printf("  LPCM    %u-channel, %s%s%s\b%s",
-                   sad->channels + 1,
-                   sad->flags.lpcm.bitrate_16_bit ? "16/" : "",
-                   sad->flags.lpcm.bitrate_20_bit ? "20/" : "",
-                   sad->flags.lpcm.bitrate_24_bit ? "24/" : "",
-
-                   ((sad->flags.lpcm.bitrate_16_bit +
-                     sad->flags.lpcm.bitrate_20_bit +
-                     sad->flags.lpcm.bitrate_24_bit) > 1) ? " bit depths" : "-bit");
-            break;
-        case CEA861_AUDIO_FORMAT_AC_3:
-            printf("  AC-3    %u-channel, %4uk max. bit rate",
-                   sad->channels + 1,
-                   (sad->flags.maximum_bit_rate << 3));
-            break;
-        default:
-            fprintf(stderr, "unknown audio format 0x%02x\n",
-                    sad->audio_format);
-            continue;
-        }
+    struct disp_cea861_state * const state = context;
+    char *string;
+
+    (void) block;
+
+    string = _edid_timing_string(dtd);
+    printf("  Detailed timing #%u....... %s\n", ++state->dtds, string);
+    free(string);
+
+    string = _edid_mode_string(dtd);
+    printf("    Modeline............... %s\n", string);
+    free(string);
+}
+
+static void
+disp_cea861_data_block(void *context, uint8_t block,
+                       const struct cea861_data_block_header *header)
+{
+    struct disp_cea861_state * const state = context;
+
+    (void) block;
 
-        printf(" at %s%s%s%s%s%s%s\b kHz\n",
-               sad->sample_rate_32_kHz ? "32/" : "",
-               sad->sample_rate_44_1_kHz ? "44.1/" : "",
-               sad->sample_rate_48_kHz ? "48/" : "",
-               sad->sample_rate_88_2_kHz ? "88.2/" : "",
-               sad->sample_rate_96_kHz ? "96/" : "",
-               sad->sample_rate_176_4_kHz ? "176.4/" : "",
-               sad->sample_rate_192_kHz ? "192/" : "");
+    if (state->section)
+        printf("\n");
+    state->section = true;
+
+    switch (header->tag) {
+    case CEA861_DATA_BLOCK_TYPE_AUDIO:
+        printf("CE audio data (formats supported)\n");
+        break;
+    case CEA861_DATA_BLOCK_TYPE_VIDEO:
+        printf("CE video identifiers (VICs) - timing/formats supported\n");
+        break;
+    case CEA861_DATA_BLOCK_TYPE_VENDOR_SPECIFIC:
+        printf("CEA vendor specific data (VSDB)\n");
+        break;
+    case CEA861_DATA_BLOCK_TYPE_SPEAKER_ALLOCATION:
+        printf("CEA speaker allocation data\n");
+        break;
+    default:
+        state->section = false;
+        break;
     }
+}
 
-    printf("\n");
+static void
+disp_cea861_unknown_data_block(void *context, uint8_t block,
+                               const struct cea861_data_block_header *header)
+{
+    (void) context;
+    (void) block;
+
+    EDS_TRACE_COUNT(&trace, unknown_data_block[header->tag]);
+    fprintf(stderr, "unknown CEA-861 data block type 0x%02x\n", header->tag);
 }
 
-static inline void
-disp_cea861_video_data(const struct cea861_video_data_block * const vdb)
+static void
+disp_cea861_short_audio_descriptor(void *context, uint8_t block,
+                                   const struct cea861_short_audio_descriptor *sad)
 {
-    printf("CE video identifiers (VICs) - timing/formats supported\n");
-    for (uint8_t i = 0; i < vdb->header.length; i++) {
-        const struct cea861_timing * const timing =
-            &cea861_timings[vdb->svd[i].video_identification_code];
-
-        printf(" %s CEA Mode %02u: %4u x %4u%c @ %.fHz\n",
-               vdb->svd[i].native ? "*" : " ",
-               vdb->svd[i].video_identification_code,
-               timing->hactive, timing->vactive,
-               (timing->mode == INTERLACED) ? 'i' : 'p',
-               timing->vfreq);
+    (void) context;
+    (void) block;
+
+    switch (sad->audio_format) {
+    case CEA861_AUDIO_FORMAT_LPCM:
+        printf("  LPCM    %u-channel, %s%s%s\b%s",
+               sad->channels + 1,
+               sad->flags.lpcm.bitrate_16_bit ? "16/" : "",
+               sad->flags.lpcm.bitrate_20_bit ? "20/" : "",
+               sad->flags.lpcm.bitrate_24_bit ? "24/" : "",
+
+               ((sad->flags.lpcm.bitrate_16_bit +
+                 sad->flags.lpcm.bitrate_20_bit +
+                 sad->flags.lpcm.bitrate_24_bit) > 1) ? " bit depths" : "-bit");
+        break;
+    case CEA861_AUDIO_FORMAT_AC_3:
+        printf("  AC-3    %u-channel, %4uk max. bit rate",
+               sad->channels + 1,
+               (sad->flags.maximum_bit_rate << 3));
+        break;
+    default:
+        EDS_TRACE_COUNT(&trace, unknown_audio_format[sad->audio_format]);
+        fprintf(stderr, "unknown audio format 0x%02x\n",
+                sad->audio_format);
+        return;
     }
 
-    printf("\n");
+    printf(" at %s%s%s%s%s%s%s\b kHz\n",
+           sad->sample_rate_32_kHz ? "32/" : "",
+           sad->sample_rate_44_1_kHz ? "44.1/" : "",
+           sad->sample_rate_48_kHz ? "48/" : "",
+           sad->sample_rate_88_2_kHz ? "88.2/" : "",
+           sad->sample_rate_96_kHz ? "96/" : "",
+           sad->sample_rate_176_4_kHz ? "176.4/" : "",
+           sad->sample_rate_192_kHz ? "192/" : "");
 }
 
-static inline void
-disp_cea861_vendor_data(const struct cea861_vendor_specific_data_block * vsdb)
+static void
+disp_cea861_short_video_descriptor(void *context, uint8_t block,
+                                   const struct cea861_short_video_descriptor *svd)
+{
+    const uint8_t vic = cea861_short_video_descriptor_vic(svd);
+    const bool native = cea861_short_video_descriptor_native(svd);
+    const struct cea861_timing *timing;
+
+    (void) context;
+    (void) block;
+
+    if (vic >= ARRAY_SIZE(cea861_timings) || !cea861_timings[vic].hactive) {
+        printf(" %s CEA Mode %02u: unknown\n", native ? "*" : " ", vic);
+        return;
+    }
+
+    timing = &cea861_timings[vic];
+    printf(" %s CEA Mode %02u: %4u x %4u%c @ %.fHz\n",
+           native ? "*" : " ",
+           vic,
+           timing->hactive, timing->vactive,
+           (timing->mode == INTERLACED) ? 'i' : 'p',
+           timing->vfreq);
+}
+
+static void
+disp_cea861_vendor_data(void *context, uint8_t block,
+                        const struct cea861_vendor_specific_data_block *vsdb)
 {
     const uint8_t oui[] = { vsdb->ieee_registration[2],
                             vsdb->ieee_registration[1],
                             vsdb->ieee_registration[0] };
 
-    printf("CEA vendor specific data (VSDB)\n");
+    (void) context;
+    (void) block;
+
     printf("  IEEE registration number. 0x");
     for (uint8_t i = 0; i < ARRAY_SIZE(oui); i++)
         printf("%02X", oui[i]);
@@ -606,23 +719,23 @@ disp_cea861_vendor_data(const struct cea861_vendor_specific_data_block * vsdb)
             }
         }
     }
-
-    printf("\n");
 }
 
-static inline void
-disp_cea861_speaker_allocation_data(const struct cea861_speaker_allocation_data_block * const sadb)
+static void
+disp_cea861_speaker_allocation_data(void *context, uint8_t block,
+                                    const struct cea861_speaker_allocation_data_block *sadb)
 {
     const struct cea861_speaker_allocation * const sa = &sadb->payload;
-    const uint8_t * const channel_configuration = (uint8_t *) sa;
+    const uint16_t payload =
+        cea861_speaker_allocation_data_block_get_payload((const uint8_t *) sadb);
+    const struct edid_audio_channel_map * const map =
+        edid_audio_channel_map(payload);
+
+    (void) context;
+    (void) block;
 
-    printf("CEA speaker allocation data\n");
     printf("  Channel configuration.... %u.%u\n",
-           (__builtin_popcountll(channel_configuration[0] & 0xe9) << 1) +
-           (__builtin_popcountll(channel_configuration[0] & 0x14) << 0) +
-           (__builtin_popcountll(channel_configuration[1] & 0x01) << 1) +
-           (__builtin_popcountll(channel_configuration[1] & 0x06) << 0),
-           (channel_configuration[0] & 0x02));
+           map->channels - map->lfe, map->lfe);
     printf("  Front left/right......... %s\n",
            sa->front_left_right ? "Yes" : "No");
     printf("  Front LFE................ %s\n",
@@ -645,18 +758,31 @@ disp_cea861_speaker_allocation_data(const struct cea861_speaker_allocation_data_
            sa->top_center ? "Yes" : "No");
     printf("  Front center high........ %s\n",
            sa->front_center_high ? "Yes" : "No");
-
-    printf("\n");
 }
 
+static const struct edid_visitor disp_cea861_timings_visitor = {
+    .detailed_timing            = disp_cea861_detailed_timing,
+};
+
+static const struct edid_visitor disp_cea861_data_blocks_visitor = {
+    .data_block                 = disp_cea861_data_block,
+    .short_audio_descriptor     = disp_cea861_short_audio_descriptor,
+    .short_video_descriptor     = disp_cea861_short_video_descriptor,
+    .vendor_specific            = disp_cea861_vendor_data,
+    .speaker_allocation         = disp_cea861_speaker_allocation_data,
+    .unknown_data_block         = disp_cea861_unknown_data_block,
+};
+
 static void
-disp_cea861(const struct edid_extension * const ext)
+disp_cea861(const struct edid_view * const view, const uint8_t block)
 {
-    const struct edid_detailed_timing_descriptor *dtd = NULL;
     const struct cea861_timing_block * const ctb =
-        (struct cea861_timing_block *) ext;
-    const uint8_t offset = offsetof(struct cea861_timing_block, data);
-    uint8_t index = 0, i;
+        (struct cea861_timing_block *) edid_view_block(view, block);
+    const uint8_t end = edid_view_data_blocks_end(view, block);
+    const uint8_t dtds = edid_view_dtd_count(view, block);
+    struct disp_cea861_state state = {0};
+
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_CEA861);
 
     /*! \todo handle invalid revision */
 
@@ -677,155 +803,334 @@ disp_cea861(const struct edid_extension * const ext)
                ctb->native_dtds);
     }
 
-    dtd = (struct edid_detailed_timing_descriptor *) ((uint8_t *) ctb + ctb->dtd_offset);
-    for (i = 0; dtd->pixel_clock; i++, dtd++) {
-        char *string;
+    cea861_visit_layout(ctb, block, end, dtds, &disp_cea861_timings_visitor,
+                        &state);
 
-        /*! \todo ensure that we are not overstepping bounds */
+    printf("\n");
 
-        string = _edid_timing_string(dtd);
-        printf("  Detailed timing #%u....... %s\n", i + 1, string);
-        free(string);
+    cea861_visit_layout(ctb, block, end, dtds, &disp_cea861_data_blocks_visitor,
+                        &state);
+    if (state.section)
+        printf("\n");
 
-        string = _edid_mode_string(dtd);
-        printf("    Modeline............... %s\n", string);
-        free(string);
-    }
+    printf("\n");
+
+    EDS_TRACE_LEAVE(&trace);
+}
 
+
+/* parse edid routines */
+
+static void
+decode_cea861(void * const context, const uint8_t block,
+              const struct edid_extension * const extension)
+{
+    (void) extension;
+
+    dump_cea861(context, block);
+    disp_cea861(context, block);
+}
+
+static const struct edid_extension_decoder cea861_decoder = {
+    .name   = "CEA-861",
+    .decode = decode_cea861,
+};
+
+EDID_EXTENSION_DECODER(EDID_EXTENSION_CEA, cea861_decoder)
+
+static void
+decode_block_map(void * const context, const uint8_t block,
+                 const struct edid_extension * const extension)
+{
+    const uint8_t * const tags = (const uint8_t *) extension + 1;
+
+    (void) context;
+    (void) block;
+
+    dump_section("block map", (const uint8_t *) extension, 0x00, EDID_BLOCK_SIZE);
     printf("\n");
 
-    if (ctb->revision >= 3) {
-        do {
-            const struct cea861_data_block_header * const header =
-                (struct cea861_data_block_header *) &ctb->data[index];
-
-            switch (header->tag) {
-            case CEA861_DATA_BLOCK_TYPE_AUDIO:
-                {
-                    const struct cea861_audio_data_block * const db =
-                        (struct cea861_audio_data_block *) header;
-
-                    disp_cea861_audio_data(db);
-                }
-                break;
-            case CEA861_DATA_BLOCK_TYPE_VIDEO:
-                {
-                    const struct cea861_video_data_block * const db =
-                        (struct cea861_video_data_block *) header;
-
-                    disp_cea861_video_data(db);
-                }
-                break;
-            case CEA861_DATA_BLOCK_TYPE_VENDOR_SPECIFIC:
-                {
-                    const struct cea861_vendor_specific_data_block * const db =
-                        (struct cea861_vendor_specific_data_block *) header;
-
-                    disp_cea861_vendor_data(db);
-                }
-                break;
-            case CEA861_DATA_BLOCK_TYPE_SPEAKER_ALLOCATION:
-                {
-                    const struct cea861_speaker_allocation_data_block * const db =
-                        (struct cea861_speaker_allocation_data_block *) header;
-
-                    disp_cea861_speaker_allocation_data(db);
-                }
-                break;
-            default:
-                fprintf(stderr, "unknown CEA-861 data block type 0x%02x\n",
-                        header->tag);
-                break;
-            }
+    printf("Block Map\n");
+    for (uint8_t i = 0; i < EDID_BLOCK_SIZE - 2; i++) {
+        const char * const name = edid_extension_name(tags[i]);
+
+        if (!tags[i])
+            continue;
 
-            index = index + header->length + sizeof(*header);
-        } while (index < ctb->dtd_offset - offset);
+        printf("  Block %3u................ %s (%#04x)\n", i + block + 1,
+               name ? name : "unknown", tags[i]);
     }
+    printf("\n");
+}
+
+static const struct edid_extension_decoder block_map_decoder = {
+    .name   = "block map",
+    .decode = decode_block_map,
+};
+
+EDID_EXTENSION_DECODER(EDID_EXTENSION_BLOCK_MAP, block_map_decoder)
 
+/* extensions which are recognised but not interpreted are shown raw */
+static void
+decode_raw(void * const context, const uint8_t block,
+           const struct edid_extension * const extension)
+{
+    (void) context;
+    (void) block;
+
+    dump_section(edid_extension_name(extension->tag),
+                 (const uint8_t *) extension, 0x00, EDID_BLOCK_SIZE);
     printf("\n");
 }
 
+static const struct edid_extension_decoder raw_decoder = {
+    .name   = "raw",
+    .decode = decode_raw,
+};
 
-/* parse edid routines */
+static void
+decode_unknown(void * const context, const uint8_t block,
+               const struct edid_extension * const extension)
+{
+    (void) context;
+
+    EDS_TRACE_COUNT(&trace, unknown_extension[extension->tag]);
+    fprintf(stderr, "WARNING: block %u contains unknown extension (%#04x)\n",
+            block, extension->tag);
+}
 
-static const struct edid_extension_handler {
-    void (* const hex_dump)(const uint8_t * const);
-    void (* const inf_disp)(const struct edid_extension * const);
-} edid_extension_handlers[] = {
-    [EDID_EXTENSION_CEA] = { dump_cea861, disp_cea861 },
+static const struct edid_extension_decoder unknown_decoder = {
+    .name   = "unknown",
+    .decode = decode_unknown,
 };
 
 static void
-parse_edid(const uint8_t * const data)
+register_decoders(void)
 {
-    const struct edid * const edid = (struct edid *) data;
-    const struct edid_extension * const extensions =
-        (struct edid_extension *) (data + sizeof(*edid));
-
-    dump_edid1((uint8_t *) edid);
-    disp_edid1(edid);
-
-    for (uint8_t i = 0; i < edid->extensions; i++) {
-        const struct edid_extension * const extension = &extensions[i];
-        const struct edid_extension_handler * const handler =
-            &edid_extension_handlers[extension->tag];
-
-        if (!handler) {
-            fprintf(stderr,
-                    "WARNING: block %u contains unknown extension (%#04x)\n",
-                    i, extensions[i].tag);
+    static const uint8_t raw[] = {
+        EDID_EXTENSION_TIMING,
+        EDID_EXTENSION_VTB,
+        EDID_EXTENSION_EDID_2_0,
+        EDID_EXTENSION_DI,
+        EDID_EXTENSION_LS,
+        EDID_EXTENSION_MI,
+        EDID_EXTENSION_DTCDB_1,
+        EDID_EXTENSION_DTCDB_2,
+        EDID_EXTENSION_DTCDB_3,
+        EDID_EXTENSION_DDDB,
+    };
+
+    /* leave any decoder linked in for these tags in place */
+    for (uint8_t i = 0; i < ARRAY_SIZE(raw); i++)
+        if (!edid_extension_decoder(raw[i]))
+            edid_extension_register(raw[i], &raw_decoder);
+
+    edid_extension_register_default(&unknown_decoder);
+}
+
+static void
+parse_edid(const uint8_t * const data, const size_t length)
+{
+    struct edid_view view;
+
+    if (!edid_view_init(&view, data, length)) {
+        fprintf(stderr, "WARNING: missing EDID header\n");
+        return;
+    }
+
+    EDS_TRACE_COUNT(&trace, edids);
+
+    dump_edid1(data);
+    disp_edid1(edid_view_base(&view));
+
+    if (view.violations & EDID_VIOLATION_MASK(EDID_VIOLATION_EXTENSION_COUNT))
+        fprintf(stderr, "WARNING: %zu of %u extension blocks are missing\n",
+                (size_t) edid_view_base(&view)->extensions + 1 - view.blocks,
+                edid_view_base(&view)->extensions);
+
+    for (size_t i = 1; i < view.blocks; i++) {
+        EDS_TRACE_COUNT(&trace, extension[edid_view_tag(&view, i)]);
+        edid_extension_decode(&view, i,
+                              (const struct edid_extension *) edid_view_block(&view, i));
+    }
+}
+
+static void
+verify_edid(const uint8_t * const data, const long length)
+{
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_CHECKSUM);
+
+    for (long i = 0; i + EDID_BLOCK_SIZE <= length; i = i + EDID_BLOCK_SIZE)
+        if (!edid_verify_checksum(data + i))
+            fprintf(stderr, "WARNING: block %ld has an invalid checksum\n",
+                    i / EDID_BLOCK_SIZE);
+
+    EDS_TRACE_LEAVE(&trace);
+}
+
+struct parse_state {
+    const char * const *paths;
+    struct eds_input   *input;
+    int                rv;
+};
+
+static int
+parse_archive(const char * const path)
+{
+    uint8_t buffer[EDID_BLOCK_SIZE * (EDID_MAX_EXTENSIONS + 1)];
+    struct eds_archive *archive;
+    size_t count;
+
+    if ((archive = eds_archive_open(path)) == NULL) {
+        fprintf(stderr, "unable to open EDID archive %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    count = eds_archive_count(archive);
+    for (size_t i = 0; i < count; i++) {
+        struct eds_archive_edid edid;
+        const uint8_t *data;
+        size_t length;
+
+        if (!eds_archive_get(archive, i, &edid)) {
+            fprintf(stderr, "WARNING: archive entry %zu is malformed\n", i);
             continue;
         }
 
-        if (handler->hex_dump)
-            (*handler->hex_dump)((uint8_t *) extension);
+        /* parse in place; only gather the blocks which are not adjacent */
+        length = edid.blocks * EDID_BLOCK_SIZE;
+        if (!(data = eds_archive_edid_data(&edid))) {
+            for (size_t block = 0; block < edid.blocks; block++)
+                memcpy(buffer + block * EDID_BLOCK_SIZE, edid.block[block],
+                       EDID_BLOCK_SIZE);
+            data = buffer;
+        }
+
+        verify_edid(data, length);
+        parse_edid(data, length);
+    }
+
+    eds_archive_close(archive);
+    return EXIT_SUCCESS;
+}
+
+static void
+parse_input(struct parse_state * const state, const size_t index,
+            const uint8_t * const data, const ssize_t length)
+{
+    const uint8_t *edid;
+    size_t size;
+
+    if (length < 0) {
+        fprintf(stderr, "unable to read EDID data: %s\n", strerror(-length));
+        state->rv = EXIT_FAILURE;
+        return;
+    }
+
+    if (eds_archive_detect(data, length)) {
+        if (parse_archive(state->paths[index]) != EXIT_SUCCESS)
+            state->rv = EXIT_FAILURE;
+        return;
+    }
+
+    if (eds_input_decode(state->input, data, length, &edid, &size) ==
+        EDS_INPUT_FORMAT_UNKNOWN) {
+        fprintf(stderr, "%s: no EDID found in text\n", state->paths[index]);
+        state->rv = EXIT_FAILURE;
+        return;
+    }
 
-        if (handler->inf_disp)
-            (*handler->inf_disp)(extension);
+    if (size < EDID_BLOCK_SIZE) {
+        fprintf(stderr, "%s: too short to be an EDID\n", state->paths[index]);
+        state->rv = EXIT_FAILURE;
+        return;
     }
+
+    verify_edid(edid, size);
+    parse_edid(edid, size);
+}
+
+static void
+parse_file(void * const context, const size_t index,
+           const uint8_t * const data, const ssize_t length)
+{
+    /* the reader calls back as each file completes; this is not io time */
+    EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_OTHER);
+    parse_input(context, index, data, length);
+    EDS_TRACE_LEAVE(&trace);
 }
 
 int
 main(int argc, char **argv)
 {
-    uint8_t *buffer = NULL;
-    FILE *edid = NULL;
-    long length = 0;
-    int rv = EXIT_FAILURE;
+    static const struct option options[] = {
+        { "stats", no_argument, NULL, 's' },
+        { NULL,    0,           NULL,  0  },
+    };
+    struct parse_state state = { NULL, NULL, EXIT_SUCCESS };
+    struct eds_bulk_reader *reader;
+    bool stats = false;
+    int opt;
+
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+        case 's':
+            stats = true;
+            break;
+        default:
+            goto usage;
+        }
+    }
+
+    if (optind == argc)
+        goto usage;
 
-    if (argc != 2) {
-        printf("usage: %s <edid data file>\n", argv[0]);
+#if !defined(EDS_TRACE)
+    if (stats) {
+        fprintf(stderr, "statistics are unavailable: built without EDS_TRACE\n");
         return EXIT_FAILURE;
     }
+#endif
 
-    if ((edid = fopen(argv[1], "rb")) == NULL) {
-        fprintf(stderr, "unable to open EDID data: %m\n");
-        goto out;
-    }
+    register_decoders();
 
-    fseek(edid, 0, SEEK_END);
-    length = ftell(edid);
-    fseek(edid, 0, SEEK_SET);
+    if ((reader = eds_bulk_reader_new(0, 0)) == NULL) {
+        fprintf(stderr, "unable to allocate reader\n");
+        return EXIT_FAILURE;
+    }
 
-    if ((buffer = calloc(length, 1)) == NULL) {
-        fprintf(stderr, "unable to allocate space for edid data\n");
-        goto out;
+    if ((state.input = eds_input_new()) == NULL) {
+        fprintf(stderr, "unable to allocate input buffers\n");
+        eds_bulk_reader_free(reader);
+        return EXIT_FAILURE;
     }
 
-    if (fread(buffer, 1, length, edid) != length) {
-        fprintf(stderr, "unable to read EDID: %m\n");
-        goto out;
+    {
+        int error;
+
+        EDS_TRACE_ENTER(&trace, EDS_TRACE_STAGE_IO);
+        state.paths = (const char * const *) &argv[optind];
+        error = eds_bulk_read(reader, state.paths, argc - optind, parse_file,
+                              &state);
+        EDS_TRACE_LEAVE(&trace);
+
+        if (error < 0) {
+            fprintf(stderr, "unable to read EDID data: %s\n", strerror(-error));
+            state.rv = EXIT_FAILURE;
+        }
     }
 
-    parse_edid(buffer);
-    rv = EXIT_SUCCESS;
+    eds_input_free(state.input);
+    eds_bulk_reader_free(reader);
 
-out:
-    if (edid)
-        fclose(edid);
+#if defined(EDS_TRACE)
+    if (stats)
+        eds_trace_write(&trace, stderr);
+#endif
 
-    free(buffer);
+    return state.rv;
 
-    return rv;
+usage:
+    printf("usage: %s [--stats] <edid data file (binary, hex or base64) or archive>...\n", argv[0]);
+    return EXIT_FAILURE;
 }
-
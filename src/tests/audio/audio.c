@@ -0,0 +1,93 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <eds/audio.h>
+#include <eds/cea861.h>
+
+#include "harness.h"
+
+#define LPCM                                    CEA861_AUDIO_FORMAT_LPCM
+#define AC_3                                    CEA861_AUDIO_FORMAT_AC_3
+#define DEPTH_16                                (0x01)
+#define DEPTH_24                                (0x04)
+
+/* a sink with the two short audio descriptors \p a and \p b */
+static void
+_sink(struct edid_audio_caps * const caps, const uint8_t a[3],
+      const uint8_t b[3], const uint8_t speakers)
+{
+    uint8_t edid[HARNESS_EDID_SIZE];
+    uint8_t * const ext = edid + EDID_BLOCK_SIZE;
+
+    harness_edid(edid, 1, false);
+    memset(ext, 0, EDID_BLOCK_SIZE);
+    memcpy(ext, (uint8_t []) { 0x02, 0x03, 0x0f, 0x00, 0x26 }, 5);
+    memcpy(ext + 5, a, 3);
+    memcpy(ext + 8, b, 3);
+    memcpy(ext + 11, (uint8_t []) { 0x83, speakers, 0x00, 0x00 }, 4);
+    harness_checksum(ext);
+
+    EXPECT(edid_audio_caps_decode(caps, edid, HARNESS_EDID_SIZE));
+}
+
+int
+main(void)
+{
+    struct edid_audio_caps sinks[2], caps;
+
+    /* LPCM 2ch 24-bit and 8ch 16-bit at 48 kHz, 7.1 speakers */
+    _sink(&sinks[0], (uint8_t []) { 0x09, 0x04, DEPTH_24 },
+          (uint8_t []) { 0x0f, 0x04, DEPTH_16 }, 0x4f);
+    EXPECT(edid_audio_caps_channels(&sinks[0], LPCM, EDID_AUDIO_SAMPLE_RATE_48_kHz) == 8);
+    EXPECT(edid_audio_caps_channels(&sinks[0], LPCM, EDID_AUDIO_SAMPLE_RATE_44_1_kHz) == 0);
+    EXPECT(edid_audio_caps_detail(&sinks[0], LPCM, EDID_AUDIO_SAMPLE_RATE_48_kHz, 2) ==
+           (DEPTH_16 | DEPTH_24));
+    EXPECT(edid_audio_caps_detail(&sinks[0], LPCM, EDID_AUDIO_SAMPLE_RATE_48_kHz, 8) ==
+           DEPTH_16);
+    EXPECT(edid_audio_channel_map(sinks[0].speakers)->channels == 8);
+
+    /* LPCM 8ch 24-bit at 48 and 96 kHz and AC-3 6ch, 4.1 speakers */
+    _sink(&sinks[1], (uint8_t []) { 0x0f, 0x14, DEPTH_24 },
+          (uint8_t []) { 0x15, 0x04, 0x38 }, 0x0b);
+    EXPECT(edid_audio_caps_rates(&sinks[1], LPCM, 8) == 0x14);
+
+    edid_audio_caps_intersect(&caps, sinks, 2);
+    EXPECT(edid_audio_caps_rates(&caps, LPCM, 8) == 0x04);
+    EXPECT(edid_audio_caps_detail(&caps, LPCM, EDID_AUDIO_SAMPLE_RATE_48_kHz, 8) == 0);
+    EXPECT(edid_audio_caps_detail(&caps, LPCM, EDID_AUDIO_SAMPLE_RATE_48_kHz, 2) == DEPTH_24);
+    EXPECT(edid_audio_caps_channels(&caps, AC_3, EDID_AUDIO_SAMPLE_RATE_48_kHz) == 0);
+    EXPECT(edid_audio_channel_map(caps.speakers)->channels == 5);
+
+    /* allocations include front left/right */
+    EXPECT(edid_audio_channel_map(0x0a)->allocation == 0x00);
+
+    return HARNESS_RESULT();
+}
+
@@ -0,0 +1,83 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <eds/ddc.h>
+
+#include "harness.h"
+
+struct sink {
+    uint8_t edid[EDID_MAX_BLOCKS + 1][EDID_BLOCK_SIZE];
+    size_t  reads;
+};
+
+static int
+_read(void * const context, const uint16_t offset, uint8_t * const buffer,
+      const uint8_t length)
+{
+    struct sink * const sink = context;
+
+    if (offset + length > sizeof(sink->edid))
+        return -1;
+
+    memcpy(buffer, &sink->edid[0][0] + offset, length);
+    sink->reads++;
+    return 0;
+}
+
+int
+main(void)
+{
+    static struct sink sink;
+    struct edid_ddc_poll state = {0};
+    struct edid_block_mask changed;
+
+    harness_edid(sink.edid[0], 1, false);
+
+    EXPECT(edid_ddc_poll(&state, _read, &sink, &changed) == 2);
+    EXPECT(edid_block_mask_next(&changed, 0) == 0);
+    EXPECT(edid_block_mask_next(&changed, 1) == 1);
+    EXPECT(edid_block_mask_next(&changed, 2) == -1);
+    EXPECT(edid_ddc_poll(&state, _read, &sink, &changed) == 0);
+
+    sink.edid[1][EDID_CHECKSUM_OFFSET]++;
+    EXPECT(edid_ddc_poll(&state, _read, &sink, &changed) == 1);
+    EXPECT(edid_block_mask_test(&changed, 1));
+
+    /* a sink claiming 0xff extensions is clamped to the addressable blocks */
+    sink.edid[0][EDID_EXTENSIONS_OFFSET] = 0xff;
+    sink.reads = 0;
+    /* blocks 2 through 254 are new */
+    EXPECT(edid_ddc_poll(&state, _read, &sink, &changed) == EDID_MAX_EXTENSIONS - 1);
+    EXPECT(state.extensions == EDID_MAX_EXTENSIONS);
+    EXPECT(sink.reads == EDID_MAX_BLOCKS);
+    EXPECT(!edid_block_mask_test(&changed, EDID_MAX_BLOCKS));
+
+    return HARNESS_RESULT();
+}
@@ -0,0 +1,131 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <eds/dtd.h>
+
+#include "harness.h"
+
+#define RANGE_LIMITS                            (0x48)
+
+/* the definition of a timing within the limits, one row at a time */
+static bool
+_within(const struct edid_dtd_table * const table, const size_t i,
+        const struct edid_dtd_limits * const limits)
+{
+    const uint32_t htotal = table->hactive[i] + table->hblank[i];
+    const uint32_t vtotal = table->vactive[i] + table->vblank[i];
+    const double clock = table->pixel_clock[i] * 1e4;
+    const double hfreq = htotal ? clock / htotal : 0;
+    const double vfreq = vtotal ? hfreq * 1e3 / vtotal : 0;
+
+    return clock <= limits->max_pixel_clock * 1e3 &&
+           hfreq >= limits->min_hfreq && hfreq <= limits->max_hfreq &&
+           vfreq >= limits->min_vfreq && vfreq <= limits->max_vfreq;
+}
+
+/* the vectorised checks must agree with the row at a time definition */
+static void
+_check_rows(const size_t count)
+{
+    const struct edid_dtd_limits limits = {
+        .max_pixel_clock = 600000,
+        .min_hfreq = 15000, .max_hfreq = 160000,
+        .min_vfreq = 24000, .max_vfreq = 144000,
+    };
+    struct edid_dtd_table table = { .count = count };
+    uint32_t refresh[EDID_DTD_TABLE_MAX], state = 0x45445301;
+    uint64_t mask;
+
+    for (size_t i = 0; i < count; i++) {
+        state = state * 1103515245 + 12345;
+        table.pixel_clock[i] = 2000 + (state >> 8) % 60000;
+        table.hactive[i] = 640 + (state >> 4) % 3200;
+        table.hblank[i] = (state >> 12) % 400;
+        table.vactive[i] = 480 + (state >> 16) % 1700;
+        table.vblank[i] = (state >> 20) % 100;
+    }
+    /* zero totals must not divide */
+    table.hactive[3] = table.hblank[3] = 0;
+    table.vactive[5] = table.vblank[5] = 0;
+
+    mask = edid_dtd_table_check(&table, &limits);
+    edid_dtd_table_refresh(&table, refresh);
+
+    for (size_t i = 0; i < count; i++) {
+        const uint32_t htotal = table.hactive[i] + table.hblank[i];
+        const uint32_t vtotal = table.vactive[i] + table.vblank[i];
+        const double pixels = (double) htotal * vtotal;
+        const uint32_t expected = pixels ? table.pixel_clock[i] * 1e7 / pixels : 0;
+
+        EXPECT(!!(mask & (UINT64_C(1) << i)) == _within(&table, i, &limits));
+        EXPECT(refresh[i] == expected);
+    }
+}
+
+int
+main(void)
+{
+    struct edid_dtd_limits limits;
+    struct edid_dtd_table table;
+    uint8_t edid[HARNESS_EDID_SIZE];
+    size_t length;
+
+    length = harness_edid(edid, 1, false);
+    EXPECT(edid_dtd_table_decode(&table, edid, length) == 2);
+    EXPECT(edid_dtd_limits_decode(&limits, edid, length));
+    EXPECT(limits.min_vfreq == 48000 && limits.max_vfreq == 75000);
+    EXPECT(limits.min_hfreq == 30000 && limits.max_hfreq == 90000);
+    EXPECT(limits.max_pixel_clock == 170000);
+    EXPECT(edid_dtd_table_check(&table, &limits) == 0x3);
+
+    /* 1.4: 48-399 Hz, 30-510 kHz */
+    edid[RANGE_LIMITS + 4] = 0x0e;
+    edid[RANGE_LIMITS + 6] = 144;
+    edid[RANGE_LIMITS + 8] = 255;
+    EXPECT(edid_dtd_limits_decode(&limits, edid, length));
+    EXPECT(limits.min_vfreq == 48000 && limits.max_vfreq == 399000);
+    EXPECT(limits.min_hfreq == 285000 && limits.max_hfreq == 510000);
+
+    edid[RANGE_LIMITS + 4] = 0x0a;
+    EXPECT(edid_dtd_limits_decode(&limits, edid, length));
+    EXPECT(limits.min_hfreq == 30000 && limits.max_hfreq == 510000);
+    EXPECT(edid_dtd_table_check(&table, &limits) == 0x3);
+
+    /* the offsets are undefined prior to 1.4 */
+    edid[0x13] = 3;
+    EXPECT(edid_dtd_limits_decode(&limits, edid, length));
+    EXPECT(limits.max_vfreq == 144000 && limits.max_hfreq == 255000);
+
+    _check_rows(EDID_DTD_TABLE_MAX);
+    _check_rows(EDID_DTD_TABLE_MAX - 3);
+
+    return HARNESS_RESULT();
+}
+
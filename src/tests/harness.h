@@ -0,0 +1,131 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef eds_tests_harness_h
+#define eds_tests_harness_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <eds/edid.h>
+
+/*!
+ * A minimal harness for the tests: EXPECT records (rather than aborts on) a
+ * failure, and may be used from any thread; HARNESS_RESULT is the exit status.
+ */
+
+static unsigned harness_failures;
+
+#define EXPECT(condition)                                                       \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            fprintf(stderr, "%s:%d: expected %s\n", __FILE__, __LINE__,         \
+                    #condition);                                                \
+            __atomic_fetch_add(&harness_failures, 1, __ATOMIC_RELAXED);        \
+        }                                                                       \
+    } while (0)
+
+#define HARNESS_RESULT()                                                        \
+    (__atomic_load_n(&harness_failures, __ATOMIC_RELAXED) ? EXIT_FAILURE        \
+                                                          : EXIT_SUCCESS)
+
+#define HARNESS_EDID_SIZE                       (EDID_BLOCK_SIZE * 2)
+
+static inline void
+harness_checksum(uint8_t * const block)
+{
+    uint8_t sum = 0;
+
+    for (size_t i = 0; i < EDID_BLOCK_SIZE - 1; i++)
+        sum = sum + block[i];
+    block[EDID_BLOCK_SIZE - 1] = -sum;
+}
+
+/*!
+ * Build a valid EDID 1.4 for a 1920x1080 display identified by \p product,
+ * with a CEA-861 extension (video, audio and HDMI vendor blocks) unless
+ * \p base_only.  Returns the length.
+ */
+static inline size_t
+harness_edid(uint8_t * const edid, const uint16_t product, const bool base_only)
+{
+    static const uint8_t base[EDID_BLOCK_SIZE] = {
+        0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,     /* header */
+        0x14, 0x93, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,     /* EDS, serial 1 */
+        0x01, 0x1e, 0x01, 0x04,                             /* 2020, 1.4 */
+        0xa5, 0x3c, 0x22, 0x78, 0x0a,                       /* 60 x 34 cm */
+        0xee, 0x95, 0xa3, 0x54, 0x4c, 0x99, 0x26, 0x0f, 0x50, 0x54,
+        0x00, 0x00, 0x00,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        /* 1920x1080 at 60 Hz */
+        0x02, 0x3a, 0x80, 0x18, 0x71, 0x38, 0x2d, 0x40, 0x58, 0x2c,
+        0x45, 0x00, 0x58, 0x54, 0x21, 0x00, 0x00, 0x1e,
+        /* range limits: 48-75 Hz, 30-90 kHz, 170 MHz */
+        0x00, 0x00, 0x00, 0xfd, 0x00, 0x30, 0x4b, 0x1e, 0x5a, 0x11,
+        0x01, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+        0x00, 0x00, 0x00, 0xfc, 0x00, 'E', 'D', 'S', ' ', 'T',
+        'E', 'S', 'T', '\n', 0x20, 0x20, 0x20, 0x20,
+        0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00,
+    };
+    static const uint8_t cea861[] = {
+        0x02, 0x03, 0x14, 0x70,
+        0x44, 0x90, 0x04, 0x03, 0x02,                       /* VICs 16, 4, 3, 2 */
+        0x23, 0x09, 0x07, 0x07,                             /* 2ch LPCM */
+        0x66, 0x03, 0x0c, 0x00, 0x10, 0x00, 0x00,           /* HDMI 1.0.0.0 */
+        /* 1280x720 at 60 Hz */
+        0x01, 0x1d, 0x00, 0x72, 0x51, 0xd0, 0x1e, 0x20, 0x6e, 0x28,
+        0x55, 0x00, 0x58, 0x54, 0x21, 0x00, 0x00, 0x1e,
+    };
+
+    memset(edid, 0, HARNESS_EDID_SIZE);
+    memcpy(edid, base, sizeof(base));
+    edid[10] = product & 0xff;
+    edid[11] = product >> 8;
+
+    if (base_only) {
+        edid[126] = 0;
+        harness_checksum(edid);
+        return EDID_BLOCK_SIZE;
+    }
+
+    harness_checksum(edid);
+    memcpy(edid + EDID_BLOCK_SIZE, cea861, sizeof(cea861));
+    harness_checksum(edid + EDID_BLOCK_SIZE);
+    return HARNESS_EDID_SIZE;
+}
+
+#endif
+
@@ -0,0 +1,175 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <eds/input.h>
+
+#include "harness.h"
+
+/* enough for the EDID as hexdump -C output, the most verbose of the formats */
+#define TEXT_SIZE                               (HARNESS_EDID_SIZE * 5)
+
+enum style {
+    STYLE_PLAIN,                                /* 00 ff ff ... */
+    STYLE_XRANDR,                               /* \t\t00ffff... */
+    STYLE_KERNEL,                               /* [    1.234] edid: 00 ff ... */
+    STYLE_HEXDUMP,                              /* 00000000  00 ff ... |....| */
+};
+
+static size_t
+_hex(const uint8_t * const edid, const size_t length, const enum style style,
+     char * const text)
+{
+    size_t n = 0;
+
+    n += sprintf(text + n, "EDID for the display:\n");
+    for (size_t row = 0; row < length; row += 16) {
+        switch (style) {
+        case STYLE_PLAIN:
+            break;
+        case STYLE_XRANDR:
+            n += sprintf(text + n, "\t\t");
+            break;
+        case STYLE_KERNEL:
+            n += sprintf(text + n, "[    1.234] <6> edid: ");
+            break;
+        case STYLE_HEXDUMP:
+            n += sprintf(text + n, "%08zx  ", row);
+            break;
+        }
+
+        for (size_t i = row; i < row + 16; i++)
+            n += sprintf(text + n, style == STYLE_XRANDR ? "%02x" :
+                                   style == STYLE_HEXDUMP && i == row + 7 ? "%02x  " :
+                                   "%02x ", edid[i]);
+
+        if (style == STYLE_HEXDUMP) {
+            n += sprintf(text + n, " |");
+            for (size_t i = row; i < row + 16; i++)
+                text[n++] = edid[i] >= 0x20 && edid[i] < 0x7f ? edid[i] : '.';
+            n += sprintf(text + n, "|");
+        }
+
+        text[n++] = '\n';
+    }
+    if (style == STYLE_HEXDUMP)
+        n += sprintf(text + n, "%08zx\n", length);
+
+    return n;
+}
+
+static size_t
+_base64(const uint8_t * const edid, const size_t length, char * const text)
+{
+    static const char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t n = 0;
+
+    n += sprintf(text + n, "{ \"edid\": \"");
+    for (size_t i = 0; i < length; i += 3) {
+        const uint32_t triple = edid[i] << 16 |
+                                (i + 1 < length ? edid[i + 1] << 8 : 0) |
+                                (i + 2 < length ? edid[i + 2] : 0);
+
+        text[n++] = alphabet[(triple >> 18) & 0x3f];
+        text[n++] = alphabet[(triple >> 12) & 0x3f];
+        text[n++] = i + 1 < length ? alphabet[(triple >> 6) & 0x3f] : '=';
+        text[n++] = i + 2 < length ? alphabet[triple & 0x3f] : '=';
+    }
+    n += sprintf(text + n, "\" }\n");
+
+    return n;
+}
+
+static bool
+_decodes(struct eds_input * const input, const char * const text,
+         const size_t length, const enum eds_input_format format,
+         const uint8_t * const expected, const size_t size)
+{
+    const uint8_t *edid;
+    size_t decoded;
+
+    if (eds_input_detect((const uint8_t *) text, length) != format)
+        return false;
+    if (eds_input_decode(input, (const uint8_t *) text, length, &edid,
+                         &decoded) != format)
+        return false;
+    return decoded == size && !memcmp(edid, expected, size);
+}
+
+int
+main(void)
+{
+    static const enum style styles[] = {
+        STYLE_PLAIN, STYLE_XRANDR, STYLE_KERNEL, STYLE_HEXDUMP,
+    };
+    struct eds_input *input;
+    uint8_t edid[HARNESS_EDID_SIZE];
+    static char text[TEXT_SIZE];
+    const uint8_t *decoded;
+    size_t length, size;
+
+    if (!(input = eds_input_new()))
+        return EXIT_FAILURE;
+
+    length = harness_edid(edid, 1, false);
+
+    EXPECT(eds_input_detect(edid, length) == EDS_INPUT_FORMAT_BINARY);
+    EXPECT(eds_input_decode(input, edid, length, &decoded, &size) ==
+           EDS_INPUT_FORMAT_BINARY);
+    EXPECT(decoded == edid && size == length);
+
+    for (size_t i = 0; i < ARRAY_SIZE(styles); i++) {
+        size = _hex(edid, length, styles[i], text);
+        EXPECT(_decodes(input, text, size, EDS_INPUT_FORMAT_HEX, edid, length));
+    }
+
+    /* base64, embedded in JSON */
+    size = _base64(edid, length, text);
+    EXPECT(_decodes(input, text, size, EDS_INPUT_FORMAT_BASE64, edid, length));
+
+    /* trailing digits are trimmed to the extensions declared */
+    edid[126] = 0;
+    harness_checksum(edid);
+    size = _hex(edid, EDID_BLOCK_SIZE, STYLE_PLAIN, text);
+    size += sprintf(text + size, "01 02 03 04\n");
+    EXPECT(_decodes(input, text, size, EDS_INPUT_FORMAT_HEX, edid,
+                    EDID_BLOCK_SIZE));
+
+    /* lines with anything other than digits are dropped */
+    length = sprintf(text, "no EDID here\n0g 1h 2i\n");
+    EXPECT(eds_input_detect((const uint8_t *) text, length) ==
+           EDS_INPUT_FORMAT_HEX);
+    EXPECT(eds_input_decode(input, (const uint8_t *) text, length, &decoded,
+                            &size) == EDS_INPUT_FORMAT_UNKNOWN);
+
+    eds_input_free(input);
+
+    return HARNESS_RESULT();
+}
@@ -0,0 +1,127 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <eds/modes.h>
+
+#include "harness.h"
+
+#define STANDARD_TIMINGS                        (0x26)
+
+static const struct edid_drm_mode *
+_find(const struct edid_drm_mode * const modes, const size_t count,
+      const uint16_t hdisplay, const uint16_t vdisplay, const uint32_t vrefresh)
+{
+    for (size_t i = 0; i < count; i++)
+        if (modes[i].hdisplay == hdisplay && modes[i].vdisplay == vdisplay &&
+            modes[i].vrefresh == vrefresh)
+            return &modes[i];
+    return NULL;
+}
+
+/* the modes of the harness EDID at \p revision with one standard timing */
+static size_t
+_modes(const uint8_t revision, const uint8_t std0, const uint8_t std1,
+       struct edid_drm_mode * const modes, const size_t count)
+{
+    uint8_t edid[HARNESS_EDID_SIZE];
+    const size_t length = harness_edid(edid, 1, false);
+
+    edid[0x13] = revision;
+    edid[STANDARD_TIMINGS + 0] = std0;
+    edid[STANDARD_TIMINGS + 1] = std1;
+    harness_checksum(edid);
+
+    return edid_drm_modes(edid, length, modes, count);
+}
+
+/* the modes of the harness EDID with its first short video descriptor \p code */
+static size_t
+_vic(const uint8_t code, struct edid_drm_mode * const modes, const size_t count)
+{
+    uint8_t edid[HARNESS_EDID_SIZE];
+    const size_t length = harness_edid(edid, 1, false);
+
+    edid[EDID_BLOCK_SIZE + 5] = code;
+    harness_checksum(edid + EDID_BLOCK_SIZE);
+
+    return edid_drm_modes(edid, length, modes, count);
+}
+
+int
+main(void)
+{
+    struct edid_drm_mode modes[32];
+    const struct edid_drm_mode *mode;
+    size_t count;
+
+    count = _modes(4, 0x01, 0x01, modes, ARRAY_SIZE(modes));
+    EXPECT(count >= 2);
+
+    /* the first descriptor, digital separate sync, both polarities positive */
+    EXPECT(modes[0].hdisplay == 1920 && modes[0].vdisplay == 1080);
+    EXPECT(modes[0].clock == 148500 && modes[0].vrefresh == 60);
+    EXPECT(modes[0].type & EDID_DRM_MODE_TYPE_PREFERRED);
+    EXPECT(modes[0].flags == (EDID_DRM_MODE_FLAG_PHSYNC |
+                              EDID_DRM_MODE_FLAG_PVSYNC));
+    EXPECT(!strcmp(modes[0].name, "1920x1080"));
+
+    /* VIC 2 */
+    EXPECT((mode = _find(modes, count, 720, 480, 60)) && mode->clock == 27000);
+
+    /* VIC 97, past the 7-bit codes */
+    count = _vic(0x61, modes, ARRAY_SIZE(modes));
+    EXPECT((mode = _find(modes, count, 3840, 2160, 60)));
+    EXPECT(mode && mode->clock == 594000 && mode->htotal == 4400 &&
+           mode->hsync_start == 4016 && mode->vsync_start == 2168);
+
+    /* DMT, whatever the revision */
+    count = _modes(3, 0x61, 0x40, modes, ARRAY_SIZE(modes));
+    EXPECT((mode = _find(modes, count, 1024, 768, 60)));
+    EXPECT(mode && mode->clock == 65000 && mode->htotal == 1344 &&
+           mode->vtotal == 806);
+    EXPECT(mode && mode->flags == (EDID_DRM_MODE_FLAG_NHSYNC |
+                                   EDID_DRM_MODE_FLAG_NVSYNC));
+
+    /* 1152x864 at 60 Hz is not a DMT mode: GTF before 1.4 */
+    count = _modes(3, 0x71, 0x40, modes, ARRAY_SIZE(modes));
+    EXPECT((mode = _find(modes, count, 1152, 864, 60)));
+    EXPECT(mode && mode->htotal == 1520 && mode->vtotal == 895);
+    EXPECT(mode && mode->hsync_start == 1216 && mode->hsync_end == 1336);
+    EXPECT(mode && mode->vsync_start == 865 && mode->vsync_end == 868);
+
+    /* ... and CVT as of 1.4 */
+    count = _modes(4, 0x71, 0x40, modes, ARRAY_SIZE(modes));
+    EXPECT((mode = _find(modes, count, 1152, 864, 60)));
+    EXPECT(mode && mode->clock == 81750 && mode->htotal == 1520 &&
+           mode->vtotal == 897);
+    EXPECT(mode && mode->vsync_start == 867 && mode->vsync_end == 871);
+
+    return HARNESS_RESULT();
+}
@@ -0,0 +1,196 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+
+#include <eds/publish.h>
+
+#include "harness.h"
+
+#define READERS                                 (4)
+#define UPDATES                                 (20000)
+
+struct expected {
+    const char *connector;
+    uint8_t     edid[HARNESS_EDID_SIZE];
+    size_t      length;
+};
+
+static struct expected expected[2];
+static struct eds_subscriber *subscriber;
+static bool done;
+
+/* the publication must be one of the two in its entirety */
+static void
+_check(const struct eds_publication * const publication)
+{
+    const struct expected *e;
+
+    EXPECT(publication->info.product == 1 || publication->info.product == 2);
+    if (publication->info.product != 1 && publication->info.product != 2)
+        return;
+
+    e = &expected[publication->info.product - 1];
+    EXPECT(!strcmp(publication->connector, e->connector));
+    EXPECT(publication->connected && publication->valid);
+    EXPECT(publication->length == e->length);
+    EXPECT(!memcmp(publication->edid, e->edid, e->length));
+    EXPECT(edid_get_product(publication->edid) == publication->info.product);
+}
+
+static void *
+_reader(void * const context)
+{
+    struct eds_publication publication;
+    unsigned long *reads = context;
+    uint32_t sequence;
+
+    while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+        if (!(sequence = eds_subscriber_read(subscriber, 0, &publication)))
+            continue;
+
+        EXPECT(!(sequence & 1));
+        _check(&publication);
+        ++*reads;
+    }
+
+    return NULL;
+}
+
+/*
+ * Leave the sequence of \p slot odd, as a publisher which died mid update
+ * would.  The region layout is private; the slot is found by its sequence,
+ * at the start of a 64 byte line.
+ */
+static bool
+_abandon(const char * const name, const uint32_t sequence)
+{
+    const size_t size = 64 * 1024;
+    uint32_t *region;
+    bool found = false;
+    int fd;
+
+    if ((fd = shm_open(name, O_RDWR, 0)) < 0)
+        return false;
+    region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED)
+        return false;
+
+    for (size_t i = 1; i < size / 64 && !found; i++) {
+        if (region[i * 16] != sequence)
+            continue;
+        __atomic_store_n(&region[i * 16], sequence + 1, __ATOMIC_RELEASE);
+        found = true;
+    }
+
+    munmap(region, size);
+    return found;
+}
+
+int
+main(void)
+{
+    unsigned long reads[READERS] = { 0 };
+    struct eds_publication publication;
+    struct eds_publisher *publisher;
+    pthread_t readers[READERS];
+    char name[32];
+
+    snprintf(name, sizeof(name), "/eds-test-%ld", (long) getpid());
+
+    expected[0].connector = "card0-HDMI-A-1";
+    expected[0].length = harness_edid(expected[0].edid, 1, false);
+    expected[1].connector = "card1-DP-2";
+    expected[1].length = harness_edid(expected[1].edid, 2, true);
+
+    if (!(publisher = eds_publisher_new(name)))
+        return EXIT_FAILURE;
+    if (!(subscriber = eds_subscriber_new(name))) {
+        eds_publisher_free(publisher);
+        return EXIT_FAILURE;
+    }
+
+    EXPECT(eds_subscriber_read(subscriber, 0, &publication) == 0);
+    EXPECT(eds_subscriber_read(subscriber, EDS_PUBLISH_SLOTS, &publication) == 0);
+
+    for (size_t i = 0; i < READERS; i++)
+        pthread_create(&readers[i], NULL, _reader, &reads[i]);
+
+    for (unsigned i = 0; i < UPDATES; i++) {
+        const struct expected * const e = &expected[i & 1];
+
+        EXPECT(eds_publisher_update(publisher, 0, e->connector, e->edid,
+                                    e->length, NULL));
+    }
+
+    __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+    for (size_t i = 0; i < READERS; i++)
+        pthread_join(readers[i], NULL);
+
+    /* the last update wins, and the sequence has advanced with every update */
+    EXPECT(eds_subscriber_read(subscriber, 0, &publication) ==
+           eds_subscriber_sequence(subscriber, 0));
+    EXPECT(eds_subscriber_sequence(subscriber, 0) >= 2 * UPDATES);
+    EXPECT(publication.info.product == 2);
+    _check(&publication);
+
+    eds_publisher_clear(publisher, 0);
+    EXPECT(eds_subscriber_read(subscriber, 0, &publication) != 0);
+    EXPECT(!publication.connected && !publication.valid);
+
+    /* readers give up on a dead publisher's slot, and a new one recovers it */
+    EXPECT(eds_publisher_update(publisher, 0, expected[0].connector,
+                                expected[0].edid, expected[0].length, NULL));
+    EXPECT(_abandon(name, eds_subscriber_sequence(subscriber, 0)));
+    EXPECT(eds_subscriber_sequence(subscriber, 0) == 0);
+    EXPECT(eds_subscriber_read(subscriber, 0, &publication) == 0);
+
+    {
+        struct eds_publisher * const successor = eds_publisher_new(name);
+
+        EXPECT(successor);
+        EXPECT(eds_subscriber_read(subscriber, 0, &publication) != 0);
+        EXPECT(!publication.connected && !publication.valid);
+        eds_publisher_free(successor);
+    }
+
+    for (size_t i = 0; i < READERS; i++)
+        printf("reader %zu: %lu snapshots\n", i, reads[i]);
+
+    eds_subscriber_free(subscriber);
+    eds_publisher_free(publisher);
+    return HARNESS_RESULT();
+}
+
@@ -0,0 +1,90 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <eds/query.h>
+
+#include "harness.h"
+
+#define SVD_OFFSET                              (EDID_BLOCK_SIZE + 5)
+
+static bool
+_match(const char * const expression, const uint8_t * const edid,
+       const size_t length)
+{
+    struct eds_query *query;
+    bool matched;
+
+    if (!(query = eds_query_compile(expression, NULL, 0)))
+        return false;
+
+    matched = eds_query_match(query, edid, length);
+    eds_query_free(query);
+
+    return matched;
+}
+
+int
+main(void)
+{
+    static const uint8_t svds[] = { 0x90, 0x61, 0xc8, 0x80 };
+    struct eds_query *query;
+    uint8_t edid[HARNESS_EDID_SIZE];
+    char error[64];
+    size_t length;
+
+    /* the parser */
+    query = eds_query_compile("vic == 97 && !(yuv444 || max_tmds_clock < 340)",
+                              NULL, 0);
+    EXPECT(query);
+    eds_query_free(query);
+    EXPECT(!eds_query_compile("vic ==", error, sizeof(error)));
+    EXPECT(!eds_query_compile("(vic == 16", error, sizeof(error)));
+    EXPECT(!eds_query_compile("frobnicate", error, sizeof(error)));
+
+    length = harness_edid(edid, 1, false);
+    EXPECT(_match("vic == 16 && vic == 2", edid, length));
+    EXPECT(!_match("vic == 5", edid, length));
+    EXPECT(!_match("vic", edid, EDID_BLOCK_SIZE));
+
+    /* 129-192 are native VICs 1-64, 193 on are VICs themselves, 128 reserved */
+    memcpy(edid + SVD_OFFSET, svds, sizeof(svds));
+    harness_checksum(edid + EDID_BLOCK_SIZE);
+
+    EXPECT(_match("vic == 16", edid, length));
+    EXPECT(_match("vic == 97", edid, length));
+    EXPECT(_match("vic == 200", edid, length));
+    EXPECT(!_match("vic == 144", edid, length));
+    EXPECT(!_match("vic == 72", edid, length));
+    EXPECT(!_match("vic == 0 || vic == 128", edid, length));
+    EXPECT(_match("vic > 192", edid, length));
+    EXPECT(!_match("vic > 200", edid, length));
+
+    return HARNESS_RESULT();
+}
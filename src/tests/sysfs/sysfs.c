@@ -0,0 +1,180 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include <eds/sysfs.h>
+
+#include "harness.h"
+
+static char root[] = "/tmp/eds-sysfs-XXXXXX";
+
+static void
+_write(const char * const connector, const char * const attribute,
+       const void * const data, const size_t length)
+{
+    char *path;
+    int fd;
+
+    if (asprintf(&path, "%s/class/drm/%s", root, connector) < 0)
+        abort();
+    mkdir(path, 0755);
+    free(path);
+
+    if (asprintf(&path, "%s/class/drm/%s/%s", root, connector, attribute) < 0)
+        abort();
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    free(path);
+
+    EXPECT(fd >= 0);
+    if (fd < 0)
+        return;
+    EXPECT(write(fd, data, length) == (ssize_t) length);
+    close(fd);
+}
+
+static void
+_connector(const char * const connector, const uint16_t product)
+{
+    uint8_t edid[HARNESS_EDID_SIZE];
+
+    if (product) {
+        _write(connector, "status", "connected\n", 10);
+        _write(connector, "edid", edid, harness_edid(edid, product, false));
+    } else {
+        _write(connector, "status", "disconnected\n", 13);
+        _write(connector, "edid", "", 0);
+    }
+}
+
+static int
+_remove(const char *path, const struct stat *st, int flag, struct FTW *ftw)
+{
+    (void) st, (void) flag, (void) ftw;
+    return remove(path);
+}
+
+static const struct eds_sysfs_connector *
+_find(const struct eds_sysfs_scanner * const scanner, const char * const name)
+{
+    for (size_t i = 0; i < eds_sysfs_scanner_count(scanner); i++)
+        if (!strcmp(eds_sysfs_scanner_connector(scanner, i)->name, name))
+            return eds_sysfs_scanner_connector(scanner, i);
+    return NULL;
+}
+
+int
+main(void)
+{
+    const struct eds_sysfs_connector *hdmi, *dp, *edp;
+    struct eds_sysfs_scanner *scanner;
+    char *path;
+
+    if (!mkdtemp(root) || asprintf(&path, "%s/class", root) < 0)
+        return EXIT_FAILURE;
+    mkdir(path, 0755);
+    free(path);
+    if (asprintf(&path, "%s/class/drm", root) < 0)
+        return EXIT_FAILURE;
+    mkdir(path, 0755);
+    free(path);
+
+    _connector("card0-HDMI-A-1", 1);
+    _connector("card0-DP-1", 0);
+    _write("card0", "dev", "226:0\n", 6);       /* not a connector */
+
+    scanner = eds_sysfs_scanner_new(root);
+    EXPECT(scanner != NULL);
+    if (!scanner)
+        goto out;
+
+    EXPECT(eds_sysfs_scanner_fd(scanner) == -1);
+    EXPECT(eds_sysfs_scanner_count(scanner) == 2);
+    EXPECT(!strcmp(eds_sysfs_scanner_connector(scanner, 0)->name, "card0-DP-1"));
+    EXPECT((hdmi = _find(scanner, "card0-HDMI-A-1")) != NULL);
+    EXPECT((dp = _find(scanner, "card0-DP-1")) != NULL);
+    if (!hdmi || !dp)
+        goto out;
+
+    EXPECT(hdmi->connected && hdmi->valid);
+    EXPECT(hdmi->info.product == 1 && hdmi->length == HARNESS_EDID_SIZE);
+    EXPECT(!dp->connected && !dp->valid);
+
+    /* the cache is only refreshed on invalidation */
+    _connector("card0-HDMI-A-1", 2);
+    EXPECT(eds_sysfs_scanner_refresh(scanner) == 0);
+    EXPECT(hdmi->info.product == 1);
+
+    eds_sysfs_scanner_invalidate(scanner, "card0-HDMI-A-1");
+    EXPECT(eds_sysfs_scanner_refresh(scanner) == 1);
+    EXPECT(_find(scanner, "card0-HDMI-A-1") == hdmi);
+    EXPECT(hdmi->info.product == 2);
+
+    /* a status change is picked up by polling */
+    _connector("card0-DP-1", 3);
+    EXPECT(eds_sysfs_scanner_check_status(scanner) == 1);
+    EXPECT(dp->connected && dp->valid && dp->info.product == 3);
+
+    /* an unknown connector enumerates again, carrying over the others */
+    _connector("card1-eDP-1", 4);
+    eds_sysfs_scanner_invalidate(scanner, "card1-eDP-1");
+    EXPECT(eds_sysfs_scanner_refresh(scanner) == 1);
+    EXPECT(eds_sysfs_scanner_count(scanner) == 3);
+    EXPECT((edp = _find(scanner, "card1-eDP-1")) != NULL);
+    EXPECT(edp && edp->valid && edp->info.product == 4);
+    EXPECT((hdmi = _find(scanner, "card0-HDMI-A-1")) != NULL);
+    EXPECT(hdmi && hdmi->valid && hdmi->info.product == 2);
+    EXPECT(hdmi && edid_get_product(hdmi->edid) == 2);
+
+    /* a removed connector disappears on a full invalidation */
+    if (asprintf(&path, "%s/class/drm/card0-DP-1", root) < 0)
+        goto out;
+    nftw(path, _remove, 4, FTW_DEPTH | FTW_PHYS);
+    free(path);
+
+    eds_sysfs_scanner_invalidate(scanner, NULL);
+    EXPECT(eds_sysfs_scanner_refresh(scanner) == 2);
+    EXPECT(eds_sysfs_scanner_count(scanner) == 2);
+    EXPECT(_find(scanner, "card0-DP-1") == NULL);
+
+out:
+    eds_sysfs_scanner_free(scanner);
+    nftw(root, _remove, 4, FTW_DEPTH | FTW_PHYS);
+    return HARNESS_RESULT();
+}
+
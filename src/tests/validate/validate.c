@@ -0,0 +1,77 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <eds/validate.h>
+
+#include "harness.h"
+
+#define RANGE_LIMITS_FLAGS                      (0x48 + 4)
+
+static uint32_t
+_validate_flags(const uint8_t revision, const uint8_t flags)
+{
+    uint8_t edid[HARNESS_EDID_SIZE];
+    const size_t length = harness_edid(edid, 1, false);
+
+    edid[0x13] = revision;
+    edid[RANGE_LIMITS_FLAGS] = flags;
+    harness_checksum(edid);
+
+    return edid_validate(edid, length, NULL);
+}
+
+int
+main(void)
+{
+    const uint32_t reserved = EDID_VIOLATION_MASK(EDID_VIOLATION_RESERVED_BITS);
+    uint8_t edid[HARNESS_EDID_SIZE];
+    size_t length;
+
+    length = harness_edid(edid, 1, false);
+    EXPECT(edid_validate(edid, length, NULL) == 0);
+    EXPECT(edid_validate(edid, length - 1, NULL) ==
+           EDID_VIOLATION_MASK(EDID_VIOLATION_EXTENSION_COUNT));
+
+    /* 1.4 rate offsets: max vertical, max and min horizontal */
+    EXPECT(_validate_flags(4, 0x0e) == 0);
+    EXPECT(_validate_flags(4, 0x10) & reserved);
+    EXPECT(_validate_flags(4, 0x01) & reserved);
+    EXPECT(_validate_flags(4, 0x04) & reserved);
+
+    /* the byte is reserved in its entirety prior to 1.4 */
+    EXPECT(_validate_flags(3, 0x02) & reserved);
+
+    edid[EDID_BLOCK_SIZE + 0x7f] ^= 1;
+    EXPECT(edid_validate(edid, length, NULL) ==
+           EDID_VIOLATION_MASK(EDID_VIOLATION_CHECKSUM));
+
+    return HARNESS_RESULT();
+}
+
@@ -0,0 +1,196 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Generate the PNP vendor table: the IDs are packed into their 15-bit EDID
+ * representation and sorted, and the names are pooled into a single blob.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_VENDORS                             (1 << 15)
+
+struct vendor {
+    uint16_t key;
+    char     *name;
+};
+
+static struct vendor vendors[MAX_VENDORS];
+static unsigned count;
+
+static int
+compare(const void * const lhs, const void * const rhs)
+{
+    const struct vendor * const a = lhs, * const b = rhs;
+
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+static bool
+parse(FILE * const input)
+{
+    char line[512];
+    unsigned number = 0;
+
+    /* the format is that of the hwdata pnp.ids: "<ID>\t<name>" */
+    while (fgets(line, sizeof(line), input)) {
+        char *name;
+
+        ++number;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (!line[0] || line[0] == '#')
+            continue;
+
+        if (count == MAX_VENDORS) {
+            fprintf(stderr, "line %u: too many vendors\n", number);
+            return false;
+        }
+
+        if (!isupper((unsigned char) line[0]) || !isupper((unsigned char) line[1]) ||
+            !isupper((unsigned char) line[2]) || !isspace((unsigned char) line[3])) {
+            fprintf(stderr, "line %u: invalid PNP ID\n", number);
+            return false;
+        }
+
+        for (name = line + 3; isspace((unsigned char) *name); name++)
+            ;
+
+        vendors[count].key = ((line[0] - '@') << 10) | ((line[1] - '@') << 5) |
+                             ((line[2] - '@') << 0);
+        if ((vendors[count].name = strdup(name)) == NULL)
+            return false;
+        count++;
+    }
+
+    return true;
+}
+
+static void
+emit_string(FILE * const output, const char * const string)
+{
+    for (const char *p = string; *p; p++) {
+        if (*p == '"' || *p == '\\')
+            fprintf(output, "\\%c", *p);
+        else if (isprint((unsigned char) *p))
+            fputc(*p, output);
+        else
+            fprintf(output, "\\%03o", (unsigned char) *p);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    FILE *input = NULL, *output = NULL;
+    int rv = EXIT_FAILURE;
+    size_t offset = 0;
+    const char *name;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <pnp.ids> <output header>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if ((input = fopen(argv[1], "r")) == NULL) {
+        fprintf(stderr, "unable to open %s\n", argv[1]);
+        goto out;
+    }
+
+    if (!parse(input))
+        goto out;
+
+    qsort(vendors, count, sizeof(*vendors), compare);
+    for (unsigned i = 1; i < count; i++) {
+        if (vendors[i].key == vendors[i - 1].key) {
+            fprintf(stderr, "duplicate PNP ID %s\n", vendors[i].name);
+            goto out;
+        }
+    }
+
+    for (unsigned i = 0; i < count; i++)
+        offset = offset + strlen(vendors[i].name) + 1;
+
+    if ((output = fopen(argv[2], "w")) == NULL) {
+        fprintf(stderr, "unable to create %s\n", argv[2]);
+        goto out;
+    }
+
+    name = strrchr(argv[1], '/');
+    fprintf(output, "/* generated from %s; do not edit */\n\n", name ? name + 1 : argv[1]);
+    fprintf(output, "#define EDID_PNP_VENDORS                        (%u)\n\n", count);
+    fprintf(output, "typedef %s edid_pnp_offset_t;\n\n",
+            offset <= UINT16_MAX ? "uint16_t" : "uint32_t");
+
+    fprintf(output, "static const uint16_t edid_pnp_keys[EDID_PNP_VENDORS + 1] = {\n");
+    for (unsigned i = 0; i < count; i++)
+        fprintf(output, "%s0x%04x,%s", i % 8 ? " " : "    ", vendors[i].key,
+                i % 8 == 7 ? "\n" : "");
+    /* sentinel, never a valid (15-bit) key */
+    fprintf(output, "%s0xffff,\n};\n\n", count % 8 ? " " : "    ");
+
+    offset = 0;
+    fprintf(output, "static const edid_pnp_offset_t edid_pnp_offsets[EDID_PNP_VENDORS + 1] = {\n");
+    for (unsigned i = 0; i < count; i++) {
+        fprintf(output, "%s%zu,%s", i % 8 ? " " : "    ", offset,
+                i % 8 == 7 ? "\n" : "");
+        offset = offset + strlen(vendors[i].name) + 1;
+    }
+    fprintf(output, "%s%zu,\n};\n\n", count % 8 ? " " : "    ", offset);
+
+    fprintf(output, "static const char edid_pnp_names[] =\n");
+    for (unsigned i = 0; i < count; i++) {
+        fprintf(output, "    \"");
+        emit_string(output, vendors[i].name);
+        fprintf(output, "\\0\"%s", i + 1 == count ? ";\n" : "\n");
+    }
+    if (!count)
+        fprintf(output, "    \"\";\n");
+
+    rv = EXIT_SUCCESS;
+
+out:
+    if (output && fclose(output))
+        rv = EXIT_FAILURE;
+    if (input)
+        fclose(input);
+    if (rv != EXIT_SUCCESS && output)
+        remove(argv[2]);
+
+    for (unsigned i = 0; i < count; i++)
+        free(vendors[i].name);
+
+    return rv;
+}
@@ -0,0 +1,304 @@
+/* vim: set et fde fdm=syntax ft=c.doxygen ts=4 sts=4 sw=4 : */
+/*
+ * Copyright © 2026 Saleem Abdulrasool <compnerd@compnerd.org>.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Generate the quirk database: parse the quirk list and lay the entries out
+ * into a perfect hash keyed on the PNP ID and product code.
+ */
+
+#include <ctype.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ENTRIES                             (0x1000)
+
+struct entry {
+    uint32_t key;
+    unsigned line;
+    uint32_t flags;
+    uint64_t fingerprint;
+    unsigned max_tmds_clock;
+    unsigned hactive, vactive, refresh;
+};
+
+static const struct {
+    const char *name;
+    const char *flag;
+} quirks[] = {
+    { "first-detailed-preferred", "EDID_QUIRK_FIRST_DETAILED_PREFERRED" },
+    { "prefer-large-60",          "EDID_QUIRK_PREFER_LARGE_60"          },
+    { "prefer-large-75",          "EDID_QUIRK_PREFER_LARGE_75"          },
+    { "no-audio",                 "EDID_QUIRK_NO_AUDIO"                 },
+    { "max-tmds-clock",           "EDID_QUIRK_MAX_TMDS_CLOCK"           },
+    { "preferred",                "EDID_QUIRK_PREFERRED_MODE"           },
+};
+
+static struct entry entries[MAX_ENTRIES];
+static unsigned count;
+
+static inline uint32_t
+hash(const uint32_t key, const uint32_t seed, const unsigned bits)
+{
+    return (uint32_t) ((key ^ seed) * UINT32_C(0x9e3779b1)) >> (32 - bits);
+}
+
+static int
+compare(const void * const lhs, const void * const rhs)
+{
+    const struct entry * const a = lhs, * const b = rhs;
+
+    if (a->key != b->key)
+        return a->key < b->key ? -1 : 1;
+    /* fingerprinted entries are more specific and are checked first */
+    return (a->fingerprint == 0) - (b->fingerprint == 0);
+}
+
+static bool
+parse_quirk(struct entry * const entry, const char * const token)
+{
+    const char * const value = strchr(token, '=');
+    const size_t length = value ? (size_t) (value - token) : strlen(token);
+
+    if (!strncmp(token, "fingerprint", length) && value)
+        return (entry->fingerprint = strtoull(value + 1, NULL, 16)) != 0;
+
+    for (unsigned i = 0; i < sizeof(quirks) / sizeof(*quirks); i++) {
+        if (strlen(quirks[i].name) != length || strncmp(token, quirks[i].name, length))
+            continue;
+
+        entry->flags |= 1u << i;
+
+        if (!strcmp(quirks[i].name, "max-tmds-clock"))
+            return value && (entry->max_tmds_clock = strtoul(value + 1, NULL, 0));
+        if (!strcmp(quirks[i].name, "preferred"))
+            return value && sscanf(value + 1, "%ux%u@%u", &entry->hactive,
+                                   &entry->vactive, &entry->refresh) == 3;
+        return !value;
+    }
+
+    return false;
+}
+
+static bool
+parse(FILE * const input)
+{
+    char line[512];
+    unsigned number = 0;
+
+    while (fgets(line, sizeof(line), input)) {
+        struct entry * const entry = &entries[count];
+        char *token, *end, *save = NULL;
+        unsigned long product;
+
+        ++number;
+        line[strcspn(line, "#\n")] = '\0';
+
+        if ((token = strtok_r(line, " \t", &save)) == NULL)
+            continue;
+
+        if (count == MAX_ENTRIES) {
+            fprintf(stderr, "line %u: too many entries\n", number);
+            return false;
+        }
+
+        memset(entry, 0, sizeof(*entry));
+        entry->line = number;
+
+        if (strlen(token) != 3 || !isupper((unsigned char) token[0]) ||
+            !isupper((unsigned char) token[1]) || !isupper((unsigned char) token[2])) {
+            fprintf(stderr, "line %u: invalid PNP ID '%s'\n", number, token);
+            return false;
+        }
+        entry->key = (((token[0] - '@') << 10) | ((token[1] - '@') << 5) |
+                      ((token[2] - '@') << 0)) << 16;
+
+        if ((token = strtok_r(NULL, " \t", &save)) == NULL ||
+            (product = strtoul(token, &end, 0)) > 0xffff || *end) {
+            fprintf(stderr, "line %u: invalid product code\n", number);
+            return false;
+        }
+        entry->key |= product;
+
+        while ((token = strtok_r(NULL, " \t", &save))) {
+            if (!parse_quirk(entry, token)) {
+                fprintf(stderr, "line %u: invalid quirk '%s'\n", number, token);
+                return false;
+            }
+        }
+
+        count++;
+    }
+
+    return true;
+}
+
+static void
+emit_flags(FILE * const output, const uint32_t flags)
+{
+    bool first = true;
+
+    for (unsigned i = 0; i < sizeof(quirks) / sizeof(*quirks); i++) {
+        if (!(flags & (1u << i)))
+            continue;
+        fprintf(output, "%s%s", first ? "" : " | ", quirks[i].flag);
+        first = false;
+    }
+
+    if (first)
+        fprintf(output, "0");
+}
+
+int
+main(int argc, char **argv)
+{
+    static uint32_t first[1 << 16], slots[1 << 16];
+    FILE *input = NULL, *output = NULL;
+    const char *name;
+    unsigned keys = 0, bits = 1, seed = 0;
+    uint32_t state = 0x2545f491;
+    int rv = EXIT_FAILURE;
+    bool found = false;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <quirk list> <output header>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if ((input = fopen(argv[1], "r")) == NULL) {
+        fprintf(stderr, "unable to open %s\n", argv[1]);
+        goto out;
+    }
+
+    if (!parse(input))
+        goto out;
+
+    qsort(entries, count, sizeof(*entries), compare);
+
+    for (unsigned i = 0; i < count; i++) {
+        if (i && entries[i].key == entries[i - 1].key) {
+            if (entries[i].fingerprint == entries[i - 1].fingerprint) {
+                fprintf(stderr, "line %u: duplicate entry\n", entries[i].line);
+                goto out;
+            }
+            continue;
+        }
+        first[keys++] = i;
+    }
+
+    while ((1u << bits) < keys)
+        bits++;
+
+    /* grow the table until a collision free seed turns up */
+    for (; !found && bits <= 16; bits++) {
+        for (unsigned attempt = 0; !found && attempt < (1u << 16); attempt++) {
+            state = state * 1664525 + 1013904223;
+            seed = state;
+
+            memset(slots, 0, sizeof(*slots) << bits);
+            found = true;
+            for (unsigned i = 0; i < keys; i++) {
+                uint32_t * const slot = &slots[hash(entries[first[i]].key, seed, bits)];
+
+                if (*slot) {
+                    found = false;
+                    break;
+                }
+                *slot = i + 1;
+            }
+        }
+        if (found)
+            break;
+    }
+
+    if (!found) {
+        fprintf(stderr, "unable to find a perfect hash\n");
+        goto out;
+    }
+
+    if ((output = fopen(argv[2], "w")) == NULL) {
+        fprintf(stderr, "unable to create %s\n", argv[2]);
+        goto out;
+    }
+
+    name = strrchr(argv[1], '/');
+    fprintf(output, "/* generated from %s; do not edit */\n\n", name ? name + 1 : argv[1]);
+    fprintf(output, "#define EDID_QUIRK_HASH_SEED                    (UINT32_C(0x%08" PRIx32 "))\n", seed);
+    fprintf(output, "#define EDID_QUIRK_HASH_BITS                    (%u)\n", bits);
+    fprintf(output, "#define EDID_QUIRK_HASH(key)                    \\\n"
+                    "    ((uint32_t) (((key) ^ EDID_QUIRK_HASH_SEED) * UINT32_C(0x9e3779b1)) >> (32 - EDID_QUIRK_HASH_BITS))\n\n");
+
+    fprintf(output, "static const struct edid_quirk edid_quirk_entries[] = {\n");
+    for (unsigned i = 0; i < count; i++) {
+        const struct entry * const entry = &entries[i];
+
+        fprintf(output, "    [%u] = { .flags = ", i);
+        emit_flags(output, entry->flags);
+        fprintf(output, ", .fingerprint = UINT64_C(0x%016" PRIx64 ")", entry->fingerprint);
+        fprintf(output, ", .max_tmds_clock = %u", entry->max_tmds_clock);
+        fprintf(output, ", .hactive = %u, .vactive = %u, .refresh = %u },\n",
+                entry->hactive, entry->vactive, entry->refresh);
+    }
+    if (!count)
+        fprintf(output, "    { .flags = 0 },\n");
+    fprintf(output, "};\n\n");
+
+    fprintf(output, "static const struct edid_quirk_slot edid_quirk_slots[1 << EDID_QUIRK_HASH_BITS] = {\n");
+    for (unsigned i = 0; i < (1u << bits); i++) {
+        unsigned index, entries_for_key = 1;
+
+        if (!slots[i])
+            continue;
+
+        index = first[slots[i] - 1];
+        while (index + entries_for_key < count &&
+               entries[index + entries_for_key].key == entries[index].key)
+            entries_for_key++;
+
+        fprintf(output, "    [%u] = { .key = UINT32_C(0x%08" PRIx32 "), .index = %u, .count = %u },\n",
+                i, entries[index].key, index, entries_for_key);
+    }
+    fprintf(output, "};\n");
+
+    rv = EXIT_SUCCESS;
+
+out:
+    if (output && fclose(output))
+        rv = EXIT_FAILURE;
+    if (input)
+        fclose(input);
+    if (rv != EXIT_SUCCESS && output)
+        remove(argv[2]);
+
+    return rv;
+}